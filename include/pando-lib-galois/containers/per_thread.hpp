@@ -10,6 +10,7 @@
 #include "pando-rt/export.h"
 #include <pando-lib-galois/containers/dist_array.hpp>
 #include <pando-lib-galois/containers/host_local_storage.hpp>
+#include <pando-lib-galois/containers/vector_appender.hpp>
 #include <pando-lib-galois/utility/counted_iterator.hpp>
 #include <pando-lib-galois/utility/gptr_monad.hpp>
 #include <pando-lib-galois/utility/prefix_sum.hpp>
@@ -158,6 +159,14 @@ public:
     return err;
   }
 
+  /**
+   * @brief Returns an appender to the current hardware thread's vector, for tasks that append many
+   * elements.
+   */
+  VectorAppender<T> getAppender() {
+    return VectorAppender<T>(get(getLocalVectorID()));
+  }
+
   /**
    * @brief Sets the current hardware thread's vector.
    */
@@ -2,10 +2,12 @@
 // Copyright (c) 2023. University of Texas at Austin. All rights reserved.
 /* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
 
+#include <type_traits>
 #include <utility>
 
 #include "pando-rt/export.h"
 
+#include <pando-lib-galois/utility/arena.hpp>
 #include <pando-rt/containers/vector.hpp>
 #include <pando-rt/pando-rt.hpp>
 
@@ -20,14 +22,21 @@ namespace galois {
  *
  * @note A @c Stack object is empty upon construction. One of the `Stack::initialize()` functions
  *       needs to be called to allocate space.
+ *
+ * @tparam Allocator the allocator that provides the storage, e.g. @ref galois::Arena for
+ *         temporaries that are released together at the end of a @ref galois::ScopedRegion
  */
-template <typename T>
+template <typename T, typename Allocator = DefaultAllocator>
 class Stack {
 private:
   /// @brief The size of the stack
   std::uint64_t m_size = 0;
-  /// @brief An array that holds the data
-  pando::Array<T> m_buf;
+  /// @brief The capacity of the stack
+  std::uint64_t m_capacity = 0;
+  /// @brief The buffer that holds the data
+  pando::GlobalPtr<T> m_data = nullptr;
+  /// @brief The allocator of the buffer
+  Allocator m_allocator;
 
   /**
    * @brief Reserves space in the container for at least @p nextCapacity number of elements.
@@ -43,17 +52,18 @@ private:
       return pando::Status::Success;
     }
 
-    pando::Array<T> newArray;
-    auto status =
-        newArray.initialize(nextCapacity, pando::localityOf(m_buf.data()), m_buf.getMemoryType());
-    PANDO_CHECK_RETURN(status);
+    pando::GlobalPtr<T> newData = m_allocator.template allocate<T>(nextCapacity);
+    if (newData == nullptr) {
+      return pando::Status::BadAlloc;
+    }
 
     for (std::uint64_t i = 0; i < size(); i++) {
-      newArray[i] = std::move<T>(m_buf[i]);
+      newData[i] = std::move<T>(m_data[i]);
     }
 
-    std::swap(m_buf, newArray);
-    newArray.deinitialize();
+    m_allocator.template deallocate<T>(m_data, m_capacity);
+    m_data = newData;
+    m_capacity = nextCapacity;
 
     return pando::Status::Success;
   }
@@ -62,29 +72,43 @@ private:
    * @brief Reserves the current capacity * 2
    */
   pando::Status grow() {
-    if (m_buf.data() == nullptr) {
+    if (m_data == nullptr) {
       return pando::Status::NotInit;
     }
-    return reserve(m_buf.size() * 2);
+    return reserve(m_capacity * 2);
   }
 
 public:
   Stack() = default;
 
   /**
-   * @copydoc initialize(std::uint64_t)
+   * @brief Initializes the stack with the given capacity from @p allocator.
    *
-   * @param[in] place      place to allocate memory from
-   * @param[in] memoryType memory to allocate from
+   * @param[in] size      initial capacity of the stack in elements
+   * @param[in] allocator allocator to allocate the buffer from
    */
-  [[nodiscard]] pando::Status initialize(std::uint64_t size, pando::Place place,
-                                         pando::MemoryType memoryType) {
+  [[nodiscard]] pando::Status initialize(std::uint64_t size, Allocator allocator) {
     if (size < 1) {
       size = 1;
     }
-    const auto status = m_buf.initialize(size, place, memoryType);
+    m_allocator = allocator;
     m_size = 0;
-    return status;
+    m_capacity = 0;
+    m_data = nullptr;
+    return reserve(size);
+  }
+
+  /**
+   * @copydoc initialize(std::uint64_t)
+   *
+   * @param[in] place      place to allocate memory from
+   * @param[in] memoryType memory to allocate from
+   */
+  [[nodiscard]] pando::Status initialize(std::uint64_t size, pando::Place place,
+                                         pando::MemoryType memoryType)
+    requires std::is_same_v<Allocator, DefaultAllocator>
+  {
+    return initialize(size, DefaultAllocator{place, memoryType});
   }
 
   /**
@@ -94,7 +118,9 @@ public:
    *
    * @param[in] size size of vector in elements
    */
-  [[nodiscard]] pando::Status initialize(std::uint64_t size) {
+  [[nodiscard]] pando::Status initialize(std::uint64_t size)
+    requires std::is_same_v<Allocator, DefaultAllocator>
+  {
     return initialize(size, pando::getCurrentPlace(), pando::MemoryType::Main);
   }
 
@@ -102,7 +128,9 @@ public:
    * @brief Deinitializes the container.
    */
   void deinitialize() {
-    m_buf.deinitialize();
+    m_allocator.template deallocate<T>(m_data, m_capacity);
+    m_data = nullptr;
+    m_capacity = 0;
     m_size = 0;
   }
 
@@ -115,15 +143,15 @@ public:
   }
 
   size_t capacity() const {
-    return m_buf.size();
+    return m_capacity;
   }
 
   [[nodiscard]] pando::Status emplace(T elt) {
-    if (m_size >= m_buf.size()) {
+    if (m_size >= m_capacity) {
       pando::Status err = grow();
       PANDO_CHECK_RETURN(err);
     }
-    m_buf[m_size++] = elt;
+    m_data[m_size++] = elt;
     return pando::Status::Success;
   }
 
@@ -131,7 +159,7 @@ public:
     if (empty()) {
       return pando::Status::OutOfBounds;
     }
-    elt = m_buf[--m_size];
+    elt = m_data[--m_size];
     return pando::Status::Success;
   }
 };
@@ -11,6 +11,7 @@
 #include <pando-lib-galois/containers/array.hpp>
 #include <pando-lib-galois/containers/host_cached_array.hpp>
 #include <pando-lib-galois/containers/thread_local_storage.hpp>
+#include <pando-lib-galois/containers/vector_appender.hpp>
 #include <pando-lib-galois/utility/counted_iterator.hpp>
 #include <pando-lib-galois/utility/gptr_monad.hpp>
 #include <pando-lib-galois/utility/prefix_sum.hpp>
@@ -90,6 +91,14 @@ public:
     return fmap(this->getLocalRef(), pushBack, val);
   }
 
+  /**
+   * @brief Returns an appender to the current hardware thread's vector, for tasks that append many
+   * elements.
+   */
+  VectorAppender<T> getAppender() {
+    return VectorAppender<T>(this->getLocal());
+  }
+
   /**
    * @brief Returns the total number of elements in the PerThreadVector
    */
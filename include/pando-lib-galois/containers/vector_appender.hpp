@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+#ifndef PANDO_LIB_GALOIS_CONTAINERS_VECTOR_APPENDER_HPP_
+#define PANDO_LIB_GALOIS_CONTAINERS_VECTOR_APPENDER_HPP_
+
+#include <cstdint>
+#include <utility>
+
+#include "pando-rt/export.h"
+#include <pando-rt/containers/vector.hpp>
+#include <pando-rt/memory/global_ptr.hpp>
+
+namespace galois {
+
+/**
+ * @brief Appends to a vector in global memory that is owned by the calling thread.
+ *
+ * The header of the vector is read once on construction and kept in the appender, so appends only
+ * store the new element and grow the buffer geometrically in its current memory type. The header is
+ * written back by publish or on destruction.
+ *
+ * @warning The vector must not be accessed through any other path while the appender is alive.
+ */
+template <typename T>
+class VectorAppender {
+  pando::GlobalPtr<pando::Vector<T>> m_vecPtr;
+  pando::Vector<T> m_vec;
+  bool m_dirty = false;
+
+public:
+  explicit VectorAppender(pando::GlobalPtr<pando::Vector<T>> vecPtr)
+      : m_vecPtr(vecPtr), m_vec(*vecPtr) {}
+
+  VectorAppender(const VectorAppender&) = delete;
+  VectorAppender(VectorAppender&&) = delete;
+
+  ~VectorAppender() {
+    publish();
+  }
+
+  VectorAppender& operator=(const VectorAppender&) = delete;
+  VectorAppender& operator=(VectorAppender&&) = delete;
+
+  /**
+   * @brief Appends to the end of the vector.
+   */
+  [[nodiscard]] pando::Status pushBack(const T& val) {
+    m_dirty = true;
+    return m_vec.pushBack(val);
+  }
+
+  /**
+   * @copydoc pushBack(const T&)
+   */
+  [[nodiscard]] pando::Status pushBack(T&& val) {
+    m_dirty = true;
+    return m_vec.pushBack(std::move(val));
+  }
+
+  /**
+   * @brief Returns the number of elements in the vector including the unpublished ones.
+   */
+  std::uint64_t size() const noexcept {
+    return m_vec.size();
+  }
+
+  /**
+   * @brief Writes the header of the vector back to global memory.
+   */
+  void publish() {
+    if (m_dirty) {
+      *m_vecPtr = m_vec;
+      m_dirty = false;
+    }
+  }
+};
+
+} // namespace galois
+
+#endif // PANDO_LIB_GALOIS_CONTAINERS_VECTOR_APPENDER_HPP_
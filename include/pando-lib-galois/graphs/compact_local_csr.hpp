@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#ifndef PANDO_LIB_GALOIS_GRAPHS_COMPACT_LOCAL_CSR_HPP_
+#define PANDO_LIB_GALOIS_GRAPHS_COMPACT_LOCAL_CSR_HPP_
+
+#include <pando-rt/export.h>
+
+#include <cstdint>
+#include <limits>
+
+#include <pando-lib-galois/graphs/graph_traits.hpp>
+#include <pando-lib-galois/graphs/local_csr.hpp>
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+namespace galois {
+
+/**
+ * @brief A vertex of a @ref CompactLCSR, holding the index of its first edge
+ */
+template <typename IndexType>
+struct CompactVertex {
+  IndexType edgeBegin;
+};
+
+/**
+ * @brief An edge of a @ref CompactLCSR, holding the index of its destination vertex
+ */
+template <typename IndexType>
+struct CompactHalfEdge {
+  IndexType dst;
+};
+
+/**
+ * @brief An encoding of an @ref LCSR where vertices and edges hold indices of type @p IndexType
+ * into the arrays of the graph instead of global pointers
+ */
+template <typename IndexType>
+struct IndexEncoding {
+  using Vertex = CompactVertex<IndexType>;
+  using HalfEdge = CompactHalfEdge<IndexType>;
+
+  static_assert(std::numeric_limits<IndexType>::is_integer &&
+                !std::numeric_limits<IndexType>::is_signed);
+
+  static constexpr std::uint64_t maxIndex = std::numeric_limits<IndexType>::max();
+
+  static Vertex makeVertex(pando::Array<HalfEdge>, std::uint64_t edgeIndex) {
+    return Vertex{static_cast<IndexType>(edgeIndex)};
+  }
+  static HalfEdge makeHalfEdge(pando::Array<Vertex>, std::uint64_t dstIndex) {
+    return HalfEdge{static_cast<IndexType>(dstIndex)};
+  }
+  static pando::GlobalPtr<HalfEdge> edgeBegin(Vertex vertex, pando::Array<HalfEdge> edges) {
+    return edges.begin() + vertex.edgeBegin;
+  }
+  static pando::GlobalPtr<Vertex> edgeDst(HalfEdge edge, pando::Array<Vertex> vertices) {
+    return vertices.begin() + edge.dst;
+  }
+};
+
+/**
+ * @brief A local CSR with the same API as @ref LCSR that stores vertex and edge indices of type
+ * @p IndexType instead of global pointers
+ *
+ * The topology ids and edge handles are still global pointers, rebuilt from the indices and the
+ * base of the arrays of the graph when they are needed. With the default 32-bit indices a vertex
+ * and an edge take 4 bytes instead of the 8 bytes of @ref Vertex and @ref HalfEdge, so traversals
+ * move half as many bytes. Use 64-bit indices for graphs with 4B or more vertices or edges.
+ */
+template <typename VertexType, typename EdgeType, typename IndexType = std::uint32_t>
+using CompactLCSR = LCSR<VertexType, EdgeType, IndexEncoding<IndexType>>;
+
+static_assert(graph_checker<CompactLCSR<std::uint64_t, std::uint64_t>>::value);
+static_assert(sizeof(CompactHalfEdge<std::uint32_t>) * 2 == sizeof(HalfEdge));
+
+} // namespace galois
+#endif // PANDO_LIB_GALOIS_GRAPHS_COMPACT_LOCAL_CSR_HPP_
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#ifndef PANDO_LIB_GALOIS_GRAPHS_COMPRESSED_ADJACENCY_HPP_
+#define PANDO_LIB_GALOIS_GRAPHS_COMPRESSED_ADJACENCY_HPP_
+
+#include <pando-rt/export.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <pando-lib-galois/graphs/graph_traits.hpp>
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/containers/vector.hpp>
+#include <pando-rt/memory/global_ptr.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+namespace galois {
+
+/**
+ * @brief Read-only adjacency of a local graph that stores the neighbors of every vertex as sorted
+ * host-local indices, each coded as a varint of its gap from the previous neighbor
+ *
+ * A neighbor takes one byte per 7 bits of its gap instead of the 8 bytes of a @ref HalfEdge, so
+ * clustered adjacency shrinks several times and scans move far fewer bytes. Neighbors are decoded
+ * in increasing order by the iterators of @ref edges.
+ */
+class CompressedAdjacency {
+  static constexpr std::uint64_t STORE_BLOCK_SIZE = 1024;
+
+public:
+  /**
+   * @brief Decodes the neighbors of a vertex in increasing order
+   *
+   * The codes are read into a native buffer one block of up to @ref BLOCK_SIZE bytes at a time, so
+   * a scan issues one load per block instead of one per byte.
+   */
+  class NeighborIterator {
+  public:
+    static constexpr std::uint64_t BLOCK_SIZE = 64;
+
+  private:
+    pando::GlobalPtr<std::uint8_t> m_pos{};
+    pando::GlobalPtr<std::uint8_t> m_end{};
+    // global position of the first byte that is not in the buffer
+    pando::GlobalPtr<std::uint8_t> m_next{};
+    std::uint8_t m_buffer[BLOCK_SIZE];
+    std::uint64_t m_head = 0;
+    std::uint64_t m_size = 0;
+    std::uint64_t m_len = 0;
+    std::uint64_t m_value = 0;
+
+    std::uint8_t nextByte() {
+      if (m_head == m_size) {
+        m_size = std::min(BLOCK_SIZE, static_cast<std::uint64_t>(m_end - m_next));
+        pando::detail::load(m_next.address, m_size, m_buffer);
+        m_next += m_size;
+        m_head = 0;
+      }
+      return m_buffer[m_head++];
+    }
+
+    void decode() {
+      std::uint64_t gap = 0;
+      std::uint64_t shift = 0;
+      std::uint8_t byte = 0;
+      m_len = 0;
+      do {
+        byte = nextByte();
+        m_len++;
+        gap |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        shift += 7;
+      } while (byte & 0x80);
+      m_value += gap;
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::int64_t;
+    using value_type = std::uint64_t;
+    using pointer = void;
+    using reference = std::uint64_t;
+
+    NeighborIterator() noexcept = default;
+    NeighborIterator(pando::GlobalPtr<std::uint8_t> pos, pando::GlobalPtr<std::uint8_t> end)
+        : m_pos(pos), m_end(end), m_next(pos) {
+      if (m_pos != m_end) {
+        decode();
+      }
+    }
+
+    reference operator*() const noexcept {
+      return m_value;
+    }
+
+    NeighborIterator& operator++() {
+      m_pos += m_len;
+      if (m_pos != m_end) {
+        decode();
+      }
+      return *this;
+    }
+
+    NeighborIterator operator++(int) {
+      NeighborIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    friend bool operator==(const NeighborIterator& a, const NeighborIterator& b) noexcept {
+      return a.m_pos == b.m_pos;
+    }
+
+    friend bool operator!=(const NeighborIterator& a, const NeighborIterator& b) noexcept {
+      return !(a == b);
+    }
+  };
+
+  /**
+   * @brief The neighbors of a vertex
+   */
+  class NeighborRange {
+    pando::GlobalPtr<std::uint8_t> m_begin;
+    pando::GlobalPtr<std::uint8_t> m_end;
+    std::uint64_t m_size;
+
+  public:
+    NeighborRange(pando::GlobalPtr<std::uint8_t> begin, pando::GlobalPtr<std::uint8_t> end,
+                  std::uint64_t size)
+        : m_begin(begin), m_end(end), m_size(size) {}
+
+    NeighborIterator begin() const {
+      return NeighborIterator(m_begin, m_end);
+    }
+    NeighborIterator end() const {
+      return NeighborIterator(m_end, m_end);
+    }
+    std::uint64_t size() const noexcept {
+      return m_size;
+    }
+  };
+
+  constexpr CompressedAdjacency() noexcept = default;
+  constexpr CompressedAdjacency(CompressedAdjacency&&) noexcept = default;
+  constexpr CompressedAdjacency(const CompressedAdjacency&) noexcept = default;
+  ~CompressedAdjacency() = default;
+
+  constexpr CompressedAdjacency& operator=(const CompressedAdjacency&) noexcept = default;
+  constexpr CompressedAdjacency& operator=(CompressedAdjacency&&) noexcept = default;
+
+  /**
+   * @brief Compresses the adjacency of a Vector based CSR, whose inner vectors hold the indices of
+   * the neighbors of each vertex in any order
+   */
+  [[nodiscard]] pando::Status initialize(pando::Vector<pando::Vector<std::uint64_t>> edgeListCSR,
+                                         pando::Place place, pando::MemoryType memType) {
+    return build(
+        edgeListCSR.size(),
+        [&edgeListCSR](std::uint64_t vertex, std::vector<std::uint64_t>& neighbors) {
+          pando::Vector<std::uint64_t> edges = edgeListCSR[vertex];
+          neighbors.resize(edges.size());
+          for (std::uint64_t i = 0; i < edges.size(); i++) {
+            neighbors[i] = edges[i];
+          }
+        },
+        place, memType);
+  }
+
+  /**
+   * @copydoc initialize(pando::Vector<pando::Vector<std::uint64_t>>, pando::Place, pando::MemoryType)
+   */
+  [[nodiscard]] pando::Status initialize(pando::Vector<pando::Vector<std::uint64_t>> edgeListCSR) {
+    return initialize(edgeListCSR, pando::getCurrentPlace(), pando::MemoryType::Main);
+  }
+
+  /**
+   * @brief Compresses the topology of @p graph, e.g. an @ref LCSR or a @ref DistLocalCSR
+   *
+   * Vertex @c i of the adjacency is the vertex at index @c i of @p graph, and its neighbors are
+   * the indices of the destinations of its edges as returned by @c getVertexIndex.
+   */
+  template <typename Graph>
+    requires graph_checker<Graph>::value
+  [[nodiscard]] pando::Status initialize(Graph& graph, pando::Place place,
+                                         pando::MemoryType memType) {
+    // the vertices are visited in index order
+    auto vertexCurr = graph.vertices().begin();
+    return build(
+        graph.size(),
+        [&graph, &vertexCurr](std::uint64_t, std::vector<std::uint64_t>& neighbors) {
+          typename Graph::VertexTopologyID vertex = *vertexCurr;
+          ++vertexCurr;
+          neighbors.clear();
+          for (typename Graph::EdgeHandle eh : graph.edges(vertex)) {
+            neighbors.push_back(graph.getVertexIndex(graph.getEdgeDst(eh)));
+          }
+        },
+        place, memType);
+  }
+
+  /**
+   * @copydoc initialize(Graph&, pando::Place, pando::MemoryType)
+   */
+  template <typename Graph>
+    requires graph_checker<Graph>::value
+  [[nodiscard]] pando::Status initialize(Graph& graph) {
+    return initialize(graph, pando::getCurrentPlace(), pando::MemoryType::Main);
+  }
+
+  /**
+   * @brief Frees all memory and objects associated with the adjacency
+   */
+  void deinitialize() {
+    m_edgeOffsets.deinitialize();
+    m_byteOffsets.deinitialize();
+    m_bytes.deinitialize();
+  }
+
+  /** size stuff **/
+  std::uint64_t size() const noexcept {
+    return (m_edgeOffsets.size() == 0) ? 0 : m_edgeOffsets.size() - 1;
+  }
+  std::uint64_t sizeEdges() {
+    return (m_edgeOffsets.size() == 0) ? 0 : m_edgeOffsets[size()];
+  }
+  std::uint64_t sizeBytes() const noexcept {
+    return m_bytes.size();
+  }
+  std::uint64_t getNumEdges(std::uint64_t vertex) {
+    return m_edgeOffsets[vertex + 1] - m_edgeOffsets[vertex];
+  }
+
+  /**
+   * @brief Returns the indices of the neighbors of the vertex at index @p vertex in increasing
+   * order
+   */
+  NeighborRange edges(std::uint64_t vertex) {
+    return NeighborRange(m_bytes.begin() + m_byteOffsets[vertex],
+                         m_bytes.begin() + m_byteOffsets[vertex + 1], getNumEdges(vertex));
+  }
+
+private:
+  // Stores @p src to @p dst in transfers of up to STORE_BLOCK_SIZE bytes
+  template <typename T>
+  static void storeBlocks(pando::GlobalPtr<T> dst, const std::vector<T>& src) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(src.data());
+    const std::uint64_t numBytes = src.size() * sizeof(T);
+    for (std::uint64_t i = 0; i < numBytes; i += STORE_BLOCK_SIZE) {
+      pando::detail::store(dst.address + i, std::min(STORE_BLOCK_SIZE, numBytes - i), bytes + i);
+    }
+  }
+
+  /**
+   * @brief Sorts and codes the neighbors of each of the @p numVertices vertices, which
+   * @p getNeighbors writes for a vertex, in native memory and then stores the codes and offsets
+   */
+  template <typename F>
+  [[nodiscard]] pando::Status build(std::uint64_t numVertices, F getNeighbors, pando::Place place,
+                                    pando::MemoryType memType) {
+    std::vector<std::uint64_t> edgeOffsets(numVertices + 1);
+    std::vector<std::uint64_t> byteOffsets(numVertices + 1);
+    std::vector<std::uint8_t> codes;
+    std::vector<std::uint64_t> neighbors;
+    for (std::uint64_t vertex = 0; vertex < numVertices; vertex++) {
+      getNeighbors(vertex, neighbors);
+      std::sort(neighbors.begin(), neighbors.end());
+      std::uint64_t prev = 0;
+      for (std::uint64_t neighbor : neighbors) {
+        std::uint64_t gap = neighbor - prev;
+        for (; gap >= 0x80; gap >>= 7) {
+          codes.push_back(static_cast<std::uint8_t>(gap | 0x80));
+        }
+        codes.push_back(static_cast<std::uint8_t>(gap));
+        prev = neighbor;
+      }
+      edgeOffsets[vertex + 1] = edgeOffsets[vertex] + neighbors.size();
+      byteOffsets[vertex + 1] = codes.size();
+    }
+
+    pando::Status err;
+    err = m_edgeOffsets.initialize(numVertices + 1, place, memType);
+    if (err != pando::Status::Success) {
+      return err;
+    }
+    err = m_byteOffsets.initialize(numVertices + 1, place, memType);
+    if (err != pando::Status::Success) {
+      m_edgeOffsets.deinitialize();
+      return err;
+    }
+    err = m_bytes.initialize(codes.size(), place, memType);
+    if (err != pando::Status::Success) {
+      m_edgeOffsets.deinitialize();
+      m_byteOffsets.deinitialize();
+      return err;
+    }
+    storeBlocks(m_edgeOffsets.data(), edgeOffsets);
+    storeBlocks(m_byteOffsets.data(), byteOffsets);
+    storeBlocks(m_bytes.data(), codes);
+    return pando::Status::Success;
+  }
+
+  pando::Array<std::uint64_t> m_edgeOffsets;
+  pando::Array<std::uint64_t> m_byteOffsets;
+  pando::Array<std::uint8_t> m_bytes;
+};
+
+} // namespace galois
+
+#endif // PANDO_LIB_GALOIS_GRAPHS_COMPRESSED_ADJACENCY_HPP_
@@ -11,6 +11,7 @@
 #include <pando-lib-galois/containers/per_thread.hpp>
 #include <pando-lib-galois/graphs/graph_traits.hpp>
 #include <pando-lib-galois/loops/do_all.hpp>
+#include <pando-lib-galois/utility/gptr_monad.hpp>
 #include <pando-rt/containers/vector.hpp>
 
 namespace galois {
@@ -594,6 +595,20 @@ public:
     return vertex;
   }
 
+  /**
+   * @brief get the topology IDs of a batch of token IDs
+   */
+  [[nodiscard]] pando::Status getTopologyIDs(pando::Span<VertexTokenID> tokens,
+                                             pando::Span<VertexTopologyID> topologyIDs) {
+    if (topologyIDs.size() < tokens.size()) {
+      return pando::Status::OutOfBounds;
+    }
+    for (std::uint64_t i = 0; i < tokens.size(); i++) {
+      topologyIDs[i] = getTopologyID(tokens[i]);
+    }
+    return pando::Status::Success;
+  }
+
   VertexTopologyID getTopologyIDFromIndex(std::uint64_t index) {
     return index;
   }
@@ -628,6 +643,14 @@ public:
     return vertexData[vertex];
   }
 
+  /**
+   * @brief gets the member @p Field of the value of the vertex provided
+   */
+  template <auto Field>
+  auto getField(VertexTopologyID vertex) {
+    return galois::fieldOf(getData(vertex), Field);
+  }
+
   /**
    * @brief Sets the value of the edge provided
    */
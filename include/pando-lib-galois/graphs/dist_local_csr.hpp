@@ -17,6 +17,7 @@
 #include <pando-lib-galois/import/wmd_graph_importer.hpp>
 #include <pando-lib-galois/loops/do_all.hpp>
 #include <pando-lib-galois/utility/gptr_monad.hpp>
+#include <pando-lib-galois/utility/search.hpp>
 #include <pando-rt/containers/array.hpp>
 #include <pando-rt/containers/vector.hpp>
 #include <pando-rt/memory/memory_guard.hpp>
@@ -63,6 +64,7 @@ public:
   using EdgeDataRange = pando::Span<EdgeData>;
   using CSR = LCSR<VertexType, EdgeType>;
   using CSRCache = HostLocalStorage<HostIndexedMap<CSR>>;
+  using TopologyDirectoryEntry = galois::Pair<VertexTokenID, VertexTopologyID>;
 
   class VertexIt {
     CSRCache arrayOfCSRs{};
@@ -388,6 +390,8 @@ public:
       v.deinitialize();
     }
     virtualToPhysicalMap.deinitialize();
+    deinitializeTopologyDirectory();
+    topologyDirectory.deinitialize();
   }
 
   /** size stuff **/
@@ -411,12 +415,133 @@ public:
   VertexTopologyID getTopologyID(VertexTokenID tid) {
     auto [ret, found] = fmap(getLocalCSR(), relaxedGetTopologyID, tid);
     if (!found) {
+      if (hasTopologyDirectory()) {
+        return getDirectoryTopologyID(tid);
+      }
       return getGlobalTopologyID(tid);
     } else {
       return ret;
     }
   }
 
+  /**
+   * @brief Resolves a batch of token IDs to their topology IDs.
+   *
+   * Tokens present on the current host are resolved with local probes. The remaining tokens are
+   * grouped by their owning host and every group is resolved by a single task on that host, so a
+   * lookup costs a read and a write of the batch instead of a remote hash table probe.
+   *
+   * @param[in]  tokens      token IDs to resolve
+   * @param[out] topologyIDs output for the topology IDs, must be at least as long as @p tokens
+   */
+  [[nodiscard]] pando::Status getTopologyIDs(pando::Span<VertexTokenID> tokens,
+                                             pando::Span<VertexTopologyID> topologyIDs) {
+    if (topologyIDs.size() < tokens.size()) {
+      return pando::Status::OutOfBounds;
+    }
+    if (tokens.size() == 0) {
+      return pando::Status::Success;
+    }
+    if (pando::Array<TopologyDirectoryEntry> directory = topologyDirectory.getLocalRef();
+        directory.size() != 0) {
+      for (std::uint64_t i = 0; i < tokens.size(); i++) {
+        topologyIDs[i] = searchDirectory(directory, tokens[i]);
+      }
+      return pando::Status::Success;
+    }
+
+    const std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
+    pando::Array<std::uint64_t> localV2PM = virtualToPhysicalMap.getLocalRef();
+    CSR localCSR = getLocalCSR();
+
+    // counting sort of the remote tokens by their owning host
+    pando::Array<std::uint64_t> hostOffsets;
+    PANDO_CHECK_RETURN(hostOffsets.initialize(numHosts + 1));
+    hostOffsets.fill(0);
+    for (std::uint64_t i = 0; i < tokens.size(); i++) {
+      const VertexTokenID tid = tokens[i];
+      auto [ret, found] = localCSR.relaxedGetTopologyID(tid);
+      if (found) {
+        topologyIDs[i] = ret;
+      } else {
+        const std::uint64_t host = localV2PM[tid % localV2PM.size()];
+        hostOffsets[host + 1] = hostOffsets[host + 1] + 1;
+        topologyIDs[i] = nullptr;
+      }
+    }
+    for (std::uint64_t host = 0; host < numHosts; host++) {
+      hostOffsets[host + 1] = hostOffsets[host + 1] + hostOffsets[host];
+    }
+    const std::uint64_t numRemote = hostOffsets[numHosts];
+    if (numRemote == 0) {
+      hostOffsets.deinitialize();
+      return pando::Status::Success;
+    }
+
+    pando::Array<VertexTokenID> batchTokens;
+    PANDO_CHECK_RETURN(batchTokens.initialize(numRemote));
+    pando::Array<VertexTopologyID> batchTopologyIDs;
+    PANDO_CHECK_RETURN(batchTopologyIDs.initialize(numRemote));
+    pando::Array<std::uint64_t> batchIndices;
+    PANDO_CHECK_RETURN(batchIndices.initialize(numRemote));
+    pando::Array<std::uint64_t> hostCursors;
+    PANDO_CHECK_RETURN(hostCursors.initialize(numHosts));
+    for (std::uint64_t host = 0; host < numHosts; host++) {
+      hostCursors[host] = hostOffsets[host];
+    }
+    for (std::uint64_t i = 0; i < tokens.size(); i++) {
+      if (static_cast<VertexTopologyID>(topologyIDs[i]) == nullptr) {
+        const VertexTokenID tid = tokens[i];
+        const std::uint64_t host = localV2PM[tid % localV2PM.size()];
+        const std::uint64_t slot = hostCursors[host];
+        hostCursors[host] = slot + 1;
+        batchTokens[slot] = tid;
+        batchIndices[slot] = i;
+      }
+    }
+    hostCursors.deinitialize();
+
+    auto resolveBatch = +[](DistLocalCSR<VertexType, EdgeType> dlcsr,
+                            pando::Span<VertexTokenID> tokens,
+                            pando::Span<VertexTopologyID> topologyIDs,
+                            galois::WaitGroup::HandleType wgh) {
+      CSR localCSR = dlcsr.getLocalCSR();
+      for (std::uint64_t i = 0; i < tokens.size(); i++) {
+        topologyIDs[i] = localCSR.getTopologyID(tokens[i]);
+      }
+      wgh.done();
+    };
+
+    galois::WaitGroup wg;
+    PANDO_CHECK_RETURN(wg.initialize(0));
+    auto wgh = wg.getHandle();
+    for (std::uint64_t host = 0; host < numHosts; host++) {
+      const std::uint64_t begin = hostOffsets[host];
+      const std::uint64_t count = hostOffsets[host + 1] - begin;
+      if (count == 0) {
+        continue;
+      }
+      wgh.addOne();
+      pando::Place place = pando::Place{pando::NodeIndex{static_cast<std::int64_t>(host)},
+                                        pando::anyPod, pando::anyCore};
+      PANDO_CHECK_RETURN(pando::executeOn(
+          place, resolveBatch, *this, pando::Span<VertexTokenID>(batchTokens.begin() + begin, count),
+          pando::Span<VertexTopologyID>(batchTopologyIDs.begin() + begin, count), wgh));
+    }
+    PANDO_CHECK_RETURN(wg.wait());
+    wg.deinitialize();
+
+    for (std::uint64_t slot = 0; slot < numRemote; slot++) {
+      topologyIDs[batchIndices[slot]] = batchTopologyIDs[slot];
+    }
+
+    hostOffsets.deinitialize();
+    batchTokens.deinitialize();
+    batchTopologyIDs.deinitialize();
+    batchIndices.deinitialize();
+    return pando::Status::Success;
+  }
+
   // This function is for mirrored dist local csr, or classes which will directly use it. Don't use
   // it externally. getLocalTopologyID with non-existing tokenID will return failure.
   Pair<VertexTopologyID, bool> getLocalTopologyID(VertexTokenID tid) {
@@ -430,6 +555,28 @@ private:
     return fmap(getCSR(physicalHost), getTopologyID, tid);
   }
 
+  static VertexTopologyID searchDirectory(pando::Array<TopologyDirectoryEntry> directory,
+                                          VertexTokenID tid) {
+    auto it = galois::lower_bound(
+        directory.begin(), directory.end(), tid,
+        +[](typename pando::Array<TopologyDirectoryEntry>::iterator mid, const VertexTokenID& val) {
+          TopologyDirectoryEntry entry = *mid;
+          return entry.first < val;
+        });
+    if (it == directory.end()) {
+      PANDO_ABORT("FAILURE TO FIND TOKENID");
+    }
+    TopologyDirectoryEntry entry = *it;
+    if (entry.first != tid) {
+      PANDO_ABORT("FAILURE TO FIND TOKENID");
+    }
+    return entry.second;
+  }
+
+  VertexTopologyID getDirectoryTopologyID(VertexTokenID tid) {
+    return searchDirectory(topologyDirectory.getLocalRef(), tid);
+  }
+
 public:
   VertexTopologyID getTopologyIDFromIndex(std::uint64_t index) {
     std::uint64_t hostNum = 0;
@@ -469,6 +616,13 @@ public:
   pando::GlobalRef<VertexData> getData(VertexTopologyID vertex) {
     return fmap(getCSR(vertex), getData, vertex);
   }
+  /**
+   * @brief Returns a reference to the member @p Field of the data of @p vertex
+   */
+  template <auto Field>
+  auto getField(VertexTopologyID vertex) {
+    return galois::fieldOf(getData(vertex), Field);
+  }
   void setEdgeData(EdgeHandle eh, EdgeData data) {
     fmapVoid(getCSR(eh), setEdgeData, eh, data);
   }
@@ -563,6 +717,7 @@ public:
     this->numVertices = numVertices;
     std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
     PANDO_CHECK_RETURN(arrayOfCSRs.initialize());
+    PANDO_CHECK_RETURN(initializeTopologyDirectorySlots());
 
     galois::WaitGroup wg;
     PANDO_CHECK_RETURN(wg.initialize(numHosts));
@@ -680,10 +835,10 @@ public:
         static_cast<pando::Array<galois::Pair<std::uint64_t, std::uint64_t>>>(*labeledEdgeCounts)));
 #endif
 
-    galois::HostIndexedMap<pando::Vector<VertexType>> pHV{};
+    galois::HostLocalStorage<pando::Vector<VertexType>> pHV{};
 
     if constexpr (isEdgeList) {
-      pando::GlobalPtr<galois::HostIndexedMap<pando::Vector<VertexType>>> readPart{};
+      pando::GlobalPtr<galois::HostLocalStorage<pando::Vector<VertexType>>> readPart{};
       pando::LocalStorageGuard readPartGuard(readPart, 1);
       PANDO_CHECK_RETURN(localVertices.hostFlatten((*readPart)));
 
@@ -707,8 +862,8 @@ public:
         PANDO_CHECK(fmap(pHV[h], initialize, 0));
       }
       struct PHPV {
-        HostIndexedMap<pando::Vector<pando::Vector<EdgeType>>> partEdges;
-        HostIndexedMap<pando::Vector<VertexType>> pHV;
+        HostLocalStorage<pando::Vector<pando::Vector<EdgeType>>> partEdges;
+        HostLocalStorage<pando::Vector<VertexType>> pHV;
       };
       PHPV phpv{partEdges, pHV};
       galois::doAllEvenlyPartition(
@@ -886,6 +1041,7 @@ public:
     numVertices = vertices.size();
     numEdges = edges.size();
     PANDO_CHECK_RETURN(arrayOfCSRs.initialize());
+    PANDO_CHECK_RETURN(initializeTopologyDirectorySlots());
     pando::Array<std::uint64_t> v2PM;
     PANDO_CHECK_RETURN(v2PM.initialize(vertices.size()));
     std::uint64_t hosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
@@ -1001,6 +1157,7 @@ public:
 
     std::uint64_t hosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
     PANDO_CHECK_RETURN(arrayOfCSRs.initialize());
+    PANDO_CHECK_RETURN(initializeTopologyDirectorySlots());
     PANDO_CHECK_RETURN(vertices.computeIndices());
     PANDO_CHECK_RETURN(edges.computeIndices());
     PANDO_CHECK_RETURN(edgeDsts.computeIndices());
@@ -1218,11 +1375,81 @@ public:
         });
   }
 
+  /**
+   * @brief Replicates a sorted token to topology directory on every host
+   *
+   * Once built, token lookups that miss in the local hash table are served by a binary search in
+   * the local directory instead of a remote probe. This costs one entry per vertex per host, so it
+   * is meant for read-heavy phases and should be dropped with `deinitializeTopologyDirectory`.
+   * The directory is shared by all copies of the graph.
+   */
+  [[nodiscard]] pando::Status buildTopologyDirectory() {
+    if (hasTopologyDirectory()) {
+      return pando::Status::Success;
+    }
+    const pando::Status err = galois::doAll(
+        *this, topologyDirectory,
+        +[](DistLocalCSR<VertexType, EdgeType> dlcsr,
+            pando::GlobalRef<pando::Array<TopologyDirectoryEntry>> directoryRef) {
+          pando::Array<TopologyDirectoryEntry> directory;
+          PANDO_CHECK(directory.initialize(dlcsr.size()));
+          std::uint64_t entry = 0;
+          for (std::uint64_t host = 0; host < dlcsr.arrayOfCSRs.size(); host++) {
+            CSR csr = dlcsr.getCSR(host);
+            for (std::uint64_t i = 0; i < csr.size(); i++, entry++) {
+              directory[entry] =
+                  TopologyDirectoryEntry(csr.topologyToToken[i], csr.getTopologyIDFromIndex(i));
+            }
+          }
+          std::sort(directory.begin(), directory.end());
+          directoryRef = directory;
+        });
+    if (err != pando::Status::Success) {
+      // free the directories of the hosts that were built
+      deinitializeTopologyDirectory();
+    }
+    return err;
+  }
+
+  /**
+   * @brief Returns true if the topology directory is built
+   */
+  bool hasTopologyDirectory() {
+    pando::Array<TopologyDirectoryEntry> directory = topologyDirectory.getLocalRef();
+    return directory.size() != 0;
+  }
+
+  /**
+   * @brief Frees the replicated topology directory, lookups go back to remote probes
+   */
+  void deinitializeTopologyDirectory() {
+    for (pando::GlobalRef<pando::Array<TopologyDirectoryEntry>> directoryRef : topologyDirectory) {
+      pando::Array<TopologyDirectoryEntry> directory = directoryRef;
+      if (directory.size() != 0) {
+        directory.deinitialize();
+        directoryRef = directory;
+      }
+    }
+  }
+
 private:
+  /**
+   * @brief Allocates the per-host directories of the graph, which are empty until the directory is
+   * built, so that every copy of the graph sees whether it is built
+   */
+  [[nodiscard]] pando::Status initializeTopologyDirectorySlots() {
+    PANDO_CHECK_RETURN(topologyDirectory.initialize());
+    for (pando::GlobalRef<pando::Array<TopologyDirectoryEntry>> directory : topologyDirectory) {
+      directory = pando::Array<TopologyDirectoryEntry>{};
+    }
+    return pando::Status::Success;
+  }
+
   HostLocalStorage<HostIndexedMap<CSR>> arrayOfCSRs;
   std::uint64_t numVertices;
   std::uint64_t numEdges;
   galois::HostLocalStorage<pando::Array<std::uint64_t>> virtualToPhysicalMap;
+  galois::HostLocalStorage<pando::Array<TopologyDirectoryEntry>> topologyDirectory;
 };
 
 static_assert(graph_checker<DistLocalCSR<std::uint64_t, std::uint64_t>>::value);
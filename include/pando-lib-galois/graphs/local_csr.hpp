@@ -7,10 +7,14 @@
 #include <pando-rt/export.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #include <pando-lib-galois/containers/hashtable.hpp>
 #include <pando-lib-galois/graphs/graph_traits.hpp>
 #include <pando-lib-galois/loops/do_all.hpp>
+#include <pando-lib-galois/utility/gptr_monad.hpp>
 #include <pando-lib-galois/utility/pair.hpp>
 #include <pando-lib-galois/utility/tuple.hpp>
 #include <pando-rt/containers/array.hpp>
@@ -234,17 +238,49 @@ public:
   }
 };
 
+/**
+ * @brief The default encoding of an @ref LCSR, where a vertex holds a global pointer to its first
+ * edge and an edge holds a global pointer to its destination vertex
+ */
+struct PointerEncoding {
+  using Vertex = galois::Vertex;
+  using HalfEdge = galois::HalfEdge;
+
+  static constexpr std::uint64_t maxIndex = std::numeric_limits<std::uint64_t>::max();
+
+  static Vertex makeVertex(pando::Array<HalfEdge> edges, std::uint64_t edgeIndex) {
+    return Vertex{edges.begin() + edgeIndex};
+  }
+  static HalfEdge makeHalfEdge(pando::Array<Vertex> vertices, std::uint64_t dstIndex) {
+    return HalfEdge{vertices.begin() + dstIndex};
+  }
+  static pando::GlobalPtr<HalfEdge> edgeBegin(Vertex vertex, pando::Array<HalfEdge>) {
+    return vertex.edgeBegin;
+  }
+  static pando::GlobalPtr<Vertex> edgeDst(HalfEdge edge, pando::Array<Vertex>) {
+    return edge.dst;
+  }
+};
+
 template <typename VertexType, typename EdgeType>
 class DistLocalCSR;
 
 template <typename VertexType, typename EdgeType>
 class MirrorDistLocalCSR;
 
-template <typename VertexType, typename EdgeType>
+/**
+ * @brief A local CSR graph
+ *
+ * @tparam Encoding how vertices and edges refer to the edges and vertices they point at, e.g.
+ * @ref PointerEncoding or @ref IndexEncoding
+ */
+template <typename VertexType, typename EdgeType, typename Encoding = PointerEncoding>
 class LCSR {
 public:
   friend DistLocalCSR<VertexType, EdgeType>;
   friend MirrorDistLocalCSR<VertexType, EdgeType>;
+  using Vertex = typename Encoding::Vertex;
+  using HalfEdge = typename Encoding::HalfEdge;
   using VertexTokenID = std::uint64_t;
   using VertexTopologyID = pando::GlobalPtr<Vertex>;
   using EdgeHandle = pando::GlobalPtr<HalfEdge>;
@@ -266,6 +302,10 @@ public:
   [[nodiscard]] pando::Status initializeTopologyMemory(std::uint64_t numVertices,
                                                        std::uint64_t numEdges, pando::Place place,
                                                        pando::MemoryType memType) {
+    if (numVertices > Encoding::maxIndex || numEdges > Encoding::maxIndex) {
+      return pando::Status::OutOfBounds;
+    }
+
     pando::Status err;
     err = vertexEdgeOffsets.initialize(numVertices + 1, place, memType);
     if (err != pando::Status::Success) {
@@ -323,6 +363,8 @@ public:
 
   /**
    * @brief initializes the memory and objects for a Vector based CSR
+   *
+   * @return OutOfBounds if the vertices or the edges cannot be encoded
    */
   [[nodiscard]] pando::Status initialize(pando::Vector<pando::Vector<std::uint64_t>> edgeListCSR) {
     pando::Status err;
@@ -342,15 +384,13 @@ public:
     }
 
     std::uint64_t edgeCurr = 0;
-    vertexEdgeOffsets[0] = Vertex{edgeDestinations.begin()};
+    vertexEdgeOffsets[0] = Encoding::makeVertex(edgeDestinations, 0);
     for (std::uint64_t vertexCurr = 0; vertexCurr < edgeListCSR.size(); vertexCurr++) {
       pando::Vector<std::uint64_t> edges = edgeListCSR[vertexCurr];
       for (auto edgesIt = edges.cbegin(); edgesIt != edges.cend(); edgesIt++, edgeCurr++) {
-        HalfEdge e;
-        e.dst = &vertexEdgeOffsets[*edgesIt];
-        edgeDestinations[edgeCurr] = e;
+        edgeDestinations[edgeCurr] = Encoding::makeHalfEdge(vertexEdgeOffsets, *edgesIt);
       }
-      vertexEdgeOffsets[vertexCurr + 1] = Vertex{&edgeDestinations[edgeCurr]};
+      vertexEdgeOffsets[vertexCurr + 1] = Encoding::makeVertex(edgeDestinations, edgeCurr);
     }
     return pando::Status::Success;
   }
@@ -384,12 +424,13 @@ private:
   }
 
   EdgeHandle halfEdgeBegin(VertexTopologyID vertex) {
-    return (vertex == vertexEdgeOffsets.begin()) ? edgeDestinations.begin()
-                                                 : static_cast<Vertex>(*(vertex)).edgeBegin;
+    return (vertex == vertexEdgeOffsets.begin())
+               ? edgeDestinations.begin()
+               : Encoding::edgeBegin(*vertex, edgeDestinations);
   }
 
   EdgeHandle halfEdgeEnd(VertexTopologyID vertex) {
-    return static_cast<Vertex>(*(vertex + 1)).edgeBegin;
+    return Encoding::edgeBegin(*(vertex + 1), edgeDestinations);
   }
 
 public:
@@ -421,7 +462,7 @@ private:
   // Use with your own risk.
   // It is reasonable only when you could handle the non-existing value outside of this function.
   galois::Pair<VertexTopologyID, bool> relaxedGetTopologyID(VertexTokenID token) {
-    pando::GlobalPtr<Vertex> ret = nullptr;
+    VertexTopologyID ret = nullptr;
     bool found = tokenToTopology.get(token, ret);
     return galois::make_tpl(ret, found);
   }
@@ -454,8 +495,7 @@ public:
     return halfEdgeBegin(vertex) + off;
   }
   VertexTopologyID getEdgeDst(EdgeHandle eh) {
-    HalfEdge e = *eh;
-    return e.dst;
+    return Encoding::edgeDst(*eh, vertexEdgeOffsets);
   }
 
   /** Data Manipulation **/
@@ -465,6 +505,15 @@ public:
   pando::GlobalRef<VertexData> getData(VertexTopologyID vertex) {
     return vertexData[findIndex(vertex, vertexEdgeOffsets)];
   }
+  /**
+   * @brief Returns a reference to the member @p Field of the data of @p vertex, so that a kernel
+   * that only needs one member, e.g. `getField<&VertexData::dist>(vertex)`, does not move the
+   * whole vertex data
+   */
+  template <auto Field>
+  auto getField(VertexTopologyID vertex) {
+    return galois::fieldOf(getData(vertex), Field);
+  }
   void setEdgeData(EdgeHandle eh, EdgeData data) {
     edgeData[findIndex(eh, edgeDestinations)] = data;
   }
@@ -486,14 +535,17 @@ public:
     return VertexRange(beg, std::min(window_sz, vertexEdgeOffsets.size() - 1 - offset_st));
   }
 
-  static EdgeRange edges(pando::GlobalPtr<galois::Vertex> vPtr) {
+  static EdgeRange edges(VertexTopologyID vPtr)
+    requires std::is_same_v<Encoding, PointerEncoding>
+  {
     Vertex v = *vPtr;
     Vertex v1 = *(vPtr + 1);
     return EdgeRange(v.edgeBegin, v1.edgeBegin - v.edgeBegin);
   }
 
-  static EdgeRange edges(pando::GlobalPtr<galois::Vertex> vPtr, uint64_t offset_st,
-                         uint64_t window_sz) {
+  static EdgeRange edges(VertexTopologyID vPtr, uint64_t offset_st, uint64_t window_sz)
+    requires std::is_same_v<Encoding, PointerEncoding>
+  {
     Vertex v = *vPtr;
     Vertex v1 = *(vPtr + 1);
 
@@ -505,8 +557,35 @@ public:
     return EdgeRange(beg, clipped_window_sz);
   }
 
+  /**
+   * @brief The edges of @p vertex, for encodings that need the edge array to find them
+   */
+  EdgeRange edges(VertexTopologyID vertex)
+    requires(!std::is_same_v<Encoding, PointerEncoding>)
+  {
+    EdgeHandle beg = halfEdgeBegin(vertex);
+    return EdgeRange(beg, halfEdgeEnd(vertex) - beg);
+  }
+
+  /**
+   * @copydoc edges(VertexTopologyID)
+   */
+  EdgeRange edges(VertexTopologyID vertex, uint64_t offset_st, uint64_t window_sz)
+    requires(!std::is_same_v<Encoding, PointerEncoding>)
+  {
+    EdgeHandle first = halfEdgeBegin(vertex);
+    EdgeHandle end = halfEdgeEnd(vertex);
+
+    auto beg = first + offset_st;
+    if (beg > end)
+      return EdgeRange(first, 0);
+
+    auto clipped_window_sz = std::min(window_sz, (uint64_t)(end - beg));
+    return EdgeRange(beg, clipped_window_sz);
+  }
+
   VertexDataRange vertexDataRange() noexcept {
-    return VertexDataRange(vertexData.begin(), vertexData.size() - 1);
+    return VertexDataRange(vertexData.begin(), vertexData.size());
   }
   EdgeDataRange edgeDataRange(VertexTopologyID vertex) noexcept {
     auto beg = findIndex(halfEdgeBegin(vertex), edgeDestinations);
@@ -562,7 +641,7 @@ private:
   pando::Array<VertexData> vertexData;
   pando::Array<EdgeData> edgeData;
   pando::Array<std::uint64_t> topologyToToken;
-  galois::HashTable<std::uint64_t, pando::GlobalPtr<Vertex>> tokenToTopology;
+  galois::HashTable<std::uint64_t, VertexTopologyID> tokenToTopology;
 };
 
 static_assert(graph_checker<LCSR<std::uint64_t, std::uint64_t>>::value);
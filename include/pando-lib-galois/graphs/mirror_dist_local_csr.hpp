@@ -119,6 +119,10 @@ public:
   VertexTopologyID getTopologyID(VertexTokenID tid) {
     return dlcsr.getTopologyID(tid);
   }
+  [[nodiscard]] pando::Status getTopologyIDs(pando::Span<VertexTokenID> tokens,
+                                             pando::Span<VertexTopologyID> topologyIDs) {
+    return dlcsr.getTopologyIDs(tokens, topologyIDs);
+  }
   VertexTopologyID getTopologyIDFromIndex(std::uint64_t index) {
     return dlcsr.getTopologyIDFromIndex(index);
   }
@@ -149,6 +153,13 @@ public:
   pando::GlobalRef<VertexData> getData(VertexTopologyID vertex) {
     return dlcsr.getData(vertex);
   }
+  /**
+   * @brief Returns a reference to the member @p Field of the data of @p vertex
+   */
+  template <auto Field>
+  auto getField(VertexTopologyID vertex) {
+    return galois::fieldOf(getData(vertex), Field);
+  }
   void setEdgeData(EdgeHandle eh, EdgeData data) {
     dlcsr.setEdgeData(eh, data);
   }
@@ -7,6 +7,7 @@
 #include <pando-rt/export.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -16,6 +17,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <pando-lib-galois/sync/wait_group.hpp>
 #include <pando-rt/containers/vector.hpp>
 #include <pando-rt/memory/global_ptr.hpp>
 #include <pando-rt/pando-rt.hpp>
@@ -34,6 +36,9 @@ struct Vertex {
   int64_t start_indx;
   int64_t num_edges;
 };
+// Maximum number of edges moved by one transfer of copy_vhost_edges
+constexpr size_t EDGE_EXCHANGE_BATCH_SIZE = 1024;
+
 using EdgeVectorSTL = std::vector<Edge>;
 using EdgeVectorPando = pando::Vector<Edge>;
 using VertexVectorPando = pando::Vector<Vertex>;
@@ -102,4 +107,28 @@ void launch_edge_exchange(
     pando::GlobalPtr<bool> dones, pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host,
     pando::GlobalPtr<pando::Vector<pando::Vector<EdgeVectorPando>>> edges_to_send);
 
+// Copies the edges of a vhost into the final edge list of a host, EDGE_EXCHANGE_BATCH_SIZE edges
+// per transfer
+void copy_vhost_edges(galois::WaitGroup::HandleType wgh, EdgeVectorPando src_edges,
+                      pando::GlobalPtr<Edge> dest);
+
+// KERNEL: Per host
+// Sizes the final edge list of this host, then copies the edges of this host straight into the
+// final edge list of every other host as soon as that one is ready, with one copy_vhost_edges task
+// per vhost
+void stream_edges(pando::GlobalPtr<bool> done, pando::GlobalPtr<bool> ready,
+                  pando::GlobalPtr<int64_t> offsets,
+                  pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host,
+                  pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host,
+                  pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost,
+                  int64_t num_vhosts_per_host);
+
+// Replaces launch_build_edges_to_send followed by launch_edge_exchange, with the same final edge
+// lists and without building edges_to_send
+void launch_stream_edge_exchange(pando::GlobalPtr<bool> dones,
+                                 pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host,
+                                 pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host,
+                                 pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost,
+                                 int64_t num_vhosts_per_host);
+
 #endif // PANDO_LIB_GALOIS_IMPORT_EDGE_EXCHANGE_HPP_
@@ -117,9 +117,20 @@ pando::Status generateEdgesPerVirtualHost(pando::GlobalRef<pando::Vector<ELVerte
                                           std::uint64_t totalVertices, std::uint64_t vHostID,
                                           std::uint64_t numVHosts);
 
+pando::Status generateVerticesInRange(pando::GlobalRef<pando::Vector<ELVertex>> vertices,
+                                      std::uint64_t begin, std::uint64_t end);
+
+/**
+ * @brief Imports the edge list in @p filename into a distributed graph
+ *
+ * With @ref VirtualHostPolicy::Greedy there are @p vHostsScaleFactor virtual hosts per host. With
+ * @ref VirtualHostPolicy::EdgeBalancedRanges every host gets a contiguous range of vertex ids
+ * with about the same number of out-edges.
+ */
 template <typename ReturnType, typename VertexType, typename EdgeType>
 ReturnType initializeELDLCSR(pando::Array<char> filename, std::uint64_t numVertices,
-                             std::uint64_t vHostsScaleFactor = 8) {
+                             std::uint64_t vHostsScaleFactor = 8,
+                             VirtualHostPolicy policy = VirtualHostPolicy::Greedy) {
   galois::ThreadLocalVector<pando::Vector<ELEdge>> localReadEdges;
   PANDO_CHECK(localReadEdges.initialize());
 
@@ -134,7 +145,9 @@ ReturnType initializeELDLCSR(pando::Array<char> filename, std::uint64_t numVerti
   }
 
   std::uint64_t hosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
-  const std::uint64_t numVHosts = hosts * vHostsScaleFactor;
+  const std::uint64_t numVHosts = (policy == VirtualHostPolicy::EdgeBalancedRanges)
+                                      ? numVertices
+                                      : hosts * vHostsScaleFactor;
 
   galois::WaitGroup wg;
   PANDO_CHECK(wg.initialize(numThreads));
@@ -167,8 +180,8 @@ ReturnType initializeELDLCSR(pando::Array<char> filename, std::uint64_t numVerti
   auto labeledEdgeCounts =
       PANDO_EXPECT_CHECK(galois::internal::buildEdgeCountToSend<ELEdge>(numVHosts, localReadEdges));
 
-  auto [v2PM, numEdges] =
-      PANDO_EXPECT_CHECK(galois::internal::buildVirtualToPhysicalMapping(hosts, labeledEdgeCounts));
+  auto [v2PM, numEdges] = PANDO_EXPECT_CHECK(
+      galois::internal::buildVirtualToPhysicalMapping(hosts, labeledEdgeCounts, policy));
 
 #if FREE
   auto freeLabeledEdgeCounts =
@@ -189,13 +202,20 @@ ReturnType initializeELDLCSR(pando::Array<char> filename, std::uint64_t numVerti
   /**
    * Make the vertices
    */
-  auto generateVerticesState = galois::make_tpl(numVertices, hostLocalV2PM);
+  auto generateVerticesState = galois::make_tpl(numVertices, hostLocalV2PM, policy);
   auto generateVerticesPerHost = +[](decltype(generateVerticesState) state,
                                      pando::GlobalRef<pando::Vector<ELVertex>> vertices) {
-    auto [numVertices, hostLocalV2PM] = state;
+    auto [numVertices, hostLocalV2PM, policy] = state;
     PANDO_CHECK(fmap(vertices, initialize, 0));
     const std::uint64_t host = static_cast<std::uint64_t>(pando::getCurrentPlace().node.id);
     pando::Array<std::uint64_t> v2PM = hostLocalV2PM.getLocalRef();
+    if (policy == VirtualHostPolicy::EdgeBalancedRanges) {
+      // the mapping is sorted, so the range of the host is found by binary search
+      auto begin = std::lower_bound(v2PM.begin(), v2PM.end(), host);
+      auto end = std::upper_bound(begin, v2PM.end(), host);
+      PANDO_CHECK(generateVerticesInRange(vertices, begin - v2PM.begin(), end - v2PM.begin()));
+      return;
+    }
     const std::uint64_t numVHosts = v2PM.size();
     for (std::uint64_t i = 0; i < numVHosts; i++) {
       if (v2PM[i] == host) {
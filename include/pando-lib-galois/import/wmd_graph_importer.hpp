@@ -32,6 +32,26 @@
 #include <pando-rt/pando-rt.hpp>
 #include <pando-rt/sync/notification.hpp>
 
+namespace galois {
+
+/**
+ * @brief Selects how an importer assigns vertices to physical hosts
+ */
+enum class VirtualHostPolicy {
+  /**
+   * Vertex @c id belongs to virtual host @c id @c % @c numVHosts, and the virtual host with the
+   * most edges goes to the physical host with the fewest edges
+   */
+  Greedy,
+  /**
+   * Every vertex id is its own virtual host, and every physical host gets a contiguous range of
+   * vertex ids with about the same number of edges; needs dense vertex ids
+   */
+  EdgeBalancedRanges,
+};
+
+} // namespace galois
+
 namespace galois::internal {
 
 /**
@@ -128,12 +148,22 @@ buildEdgeCountToSend(std::uint64_t numVirtualHosts,
   return sumArray;
 }
 
+/**
+ * @brief Maps the virtual hosts, labeled with their edge counts, to the physical hosts as
+ * selected by @p policy, and returns the mapping with the number of edges of every physical host
+ */
 [[nodiscard]] pando::Expected<
     galois::Pair<pando::Array<std::uint64_t>, galois::HostIndexedMap<std::uint64_t>>>
 buildVirtualToPhysicalMapping(
     std::uint64_t numHosts,
-    pando::Array<galois::Pair<std::uint64_t, std::uint64_t>> labeledVirtualCounts);
+    pando::Array<galois::Pair<std::uint64_t, std::uint64_t>> labeledVirtualCounts,
+    VirtualHostPolicy policy = VirtualHostPolicy::Greedy);
 
+/**
+ * @brief Returns the physical host of vertex @p id; with
+ * @ref VirtualHostPolicy::EdgeBalancedRanges the mapping holds one entry per vertex id, so this
+ * returns the host whose range contains @p id
+ */
 inline std::uint64_t getPhysical(std::uint64_t id,
                                  pando::Array<std::uint64_t> virtualToPhysicalMapping) {
   return virtualToPhysicalMapping[id % virtualToPhysicalMapping.size()];
@@ -371,6 +401,144 @@ template <typename EdgeType>
   return pando::Status::Success;
 }
 
+/**
+ * @brief Builds the edge lists in parallel
+ *
+ * Every thread counts the edges of its vertices that each host owns and scatters them into one
+ * buffer per host in its local memory. Every host then sums the buffer sizes for its edges,
+ * reserves them, and copies the buffer of each thread with a single bulk transfer. Finally every
+ * host groups its edges by source and builds its rename map in its own memory.
+ *
+ * @note Edges of the same source are kept in the order of the threads that read them, as with
+ * partitionEdgesSerially.
+ */
+template <typename EdgeType>
+[[nodiscard]] pando::Status partitionEdgesParallel(
+    galois::PerThreadVector<pando::Vector<EdgeType>> localEdges,
+    pando::Array<std::uint64_t> virtualToPhysicalMapping,
+    galois::HostLocalStorage<pando::Vector<pando::Vector<EdgeType>>> partitionedEdges,
+    galois::HostLocalStorage<galois::HashTable<std::uint64_t, std::uint64_t>> renamePerHost) {
+  const std::uint64_t numThreads = localEdges.size();
+
+  auto hostV2PM = PANDO_EXPECT_RETURN(
+      galois::copyToAllHosts(pando::Array<std::uint64_t>(virtualToPhysicalMapping)));
+
+  // per thread buffers of the edges sent to each host
+  galois::DistArray<pando::Vector<pando::Vector<EdgeType>>> staged{};
+  PANDO_CHECK_RETURN(staged.initialize(numThreads));
+
+  auto scatterState = galois::make_tpl(localEdges, hostV2PM, staged);
+  PANDO_CHECK_RETURN(galois::doAllEvenlyPartition(
+      scatterState, numThreads,
+      +[](decltype(scatterState) scatterState, std::uint64_t tid, std::uint64_t) {
+        auto [localEdges, hostV2PM, staged] = scatterState;
+        const std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
+        pando::Array<std::uint64_t> v2PM = hostV2PM.getLocalRef();
+        pando::Vector<pando::Vector<EdgeType>> threadEdges = *localEdges.get(tid);
+
+        // all edges of a vector have the same source
+        pando::Array<std::uint64_t> edgesPerHost;
+        PANDO_CHECK(edgesPerHost.initialize(numHosts));
+        edgesPerHost.fill(0);
+        for (pando::Vector<EdgeType> vec : threadEdges) {
+          if (vec.size() != 0) {
+            EdgeType edge = vec[0];
+            edgesPerHost[getPhysical(edge.src, v2PM)] += vec.size();
+          }
+        }
+
+        pando::Vector<pando::Vector<EdgeType>> buffers;
+        PANDO_CHECK(buffers.initialize(numHosts));
+        for (std::uint64_t host = 0; host < numHosts; host++) {
+          pando::Vector<EdgeType> buffer;
+          PANDO_CHECK(buffer.initialize(0));
+          PANDO_CHECK(buffer.reserve(edgesPerHost[host]));
+          buffers[host] = buffer;
+        }
+        edgesPerHost.deinitialize();
+
+        for (pando::GlobalRef<pando::Vector<EdgeType>> vec : threadEdges) {
+          if (lift(vec, size) != 0) {
+            EdgeType edge = fmap(vec, get, 0);
+            PANDO_CHECK(fmap(buffers[getPhysical(edge.src, v2PM)], append, &vec));
+          }
+        }
+        staged[tid] = buffers;
+      }));
+
+  auto gatherState = galois::make_tpl(staged, renamePerHost);
+  PANDO_CHECK_RETURN(galois::doAll(
+      gatherState, partitionedEdges,
+      +[](decltype(gatherState) gatherState,
+          pando::GlobalRef<pando::Vector<pando::Vector<EdgeType>>> partitionedEdgesRef) {
+        auto [staged, renamePerHost] = gatherState;
+        const std::uint64_t host = static_cast<std::uint64_t>(pando::getCurrentPlace().node.id);
+
+        std::uint64_t numEdges = 0;
+        for (pando::Vector<pando::Vector<EdgeType>> buffers : staged) {
+          numEdges += lift(buffers[host], size);
+        }
+        pando::Vector<EdgeType> received;
+        PANDO_CHECK(received.initialize(0));
+        PANDO_CHECK(received.reserve(numEdges));
+        for (pando::Vector<pando::Vector<EdgeType>> buffers : staged) {
+          if (lift(buffers[host], size) != 0) {
+            PANDO_CHECK(received.append(&buffers[host]));
+          }
+        }
+
+        // consecutive edges with the same source come from the same vertex of a thread or from the
+        // same vertex of consecutive threads, so they are added to the same edge list
+        pando::Vector<pando::Vector<EdgeType>> edges;
+        PANDO_CHECK(edges.initialize(0));
+        galois::HashTable<std::uint64_t, std::uint64_t> rename(.8);
+        PANDO_CHECK(rename.initialize(0));
+        std::uint64_t index = 0;
+        std::uint64_t src = 0;
+        for (std::uint64_t i = 0; i < received.size(); i++) {
+          EdgeType edge = received[i];
+          if (i == 0 || edge.src != src) {
+            src = edge.src;
+            if (!rename.get(src, index)) {
+              index = edges.size();
+              PANDO_CHECK(rename.put(src, index));
+              pando::Vector<EdgeType> vec;
+              PANDO_CHECK(vec.initialize(0));
+              PANDO_CHECK(edges.pushBack(vec));
+            }
+          }
+          PANDO_CHECK(fmap(edges[index], pushBack, edge));
+        }
+        received.deinitialize();
+
+        partitionedEdgesRef = edges;
+        renamePerHost.getLocalRef() = rename;
+      }));
+
+  auto freeState = galois::make_tpl(staged, hostV2PM, virtualToPhysicalMapping);
+  PANDO_CHECK_RETURN(galois::doAllEvenlyPartition(
+      freeState, numThreads, +[](decltype(freeState) freeState, std::uint64_t tid, std::uint64_t) {
+        auto [staged, hostV2PM, v2PM] = freeState;
+        pando::Vector<pando::Vector<EdgeType>> buffers = staged[tid];
+        for (pando::Vector<EdgeType> buffer : buffers) {
+          buffer.deinitialize();
+        }
+        buffers.deinitialize();
+
+        // the first thread of each host frees the copy of the mapping of the host
+        const std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
+        const std::uint64_t threadsPerHost = staged.size() / numHosts;
+        pando::Array<std::uint64_t> hostCopy = hostV2PM.getLocalRef();
+        if (tid % threadsPerHost == 0 && hostCopy.data() != v2PM.data()) {
+          hostCopy.deinitialize();
+        }
+      }));
+  staged.deinitialize();
+  hostV2PM.deinitialize();
+
+  return pando::Status::Success;
+}
+
 template <typename VertexType>
 [[nodiscard]] galois::HostLocalStorage<pando::Vector<VertexType>> partitionVerticesParallel(
     galois::ThreadLocalVector<VertexType>&& localReadVertices,
@@ -525,21 +693,17 @@ template <typename VertexType>
  * by Vertex, along with a rename set of Vertices
  */
 template <typename EdgeType>
-[[nodiscard]] Pair<HostIndexedMap<pando::Vector<pando::Vector<EdgeType>>>,
-                   HostIndexedMap<HashTable<std::uint64_t, std::uint64_t>>>
+[[nodiscard]] Pair<HostLocalStorage<pando::Vector<pando::Vector<EdgeType>>>,
+                   HostLocalStorage<HashTable<std::uint64_t, std::uint64_t>>>
 partitionEdgesPerHost(PerThreadVector<pando::Vector<EdgeType>>&& localEdges,
                       pando::Array<std::uint64_t> v2PM) {
-  HostIndexedMap<pando::Vector<pando::Vector<EdgeType>>> partEdges{};
+  HostLocalStorage<pando::Vector<pando::Vector<EdgeType>>> partEdges{};
   PANDO_CHECK(partEdges.initialize());
 
-  for (pando::GlobalRef<pando::Vector<pando::Vector<EdgeType>>> vvec : partEdges) {
-    PANDO_CHECK(fmap(vvec, initialize, 0));
-  }
-
-  HostIndexedMap<HashTable<std::uint64_t, std::uint64_t>> renamePerHost{};
+  HostLocalStorage<HashTable<std::uint64_t, std::uint64_t>> renamePerHost{};
   PANDO_CHECK(renamePerHost.initialize());
 
-  PANDO_CHECK(galois::internal::partitionEdgesSerially(localEdges, v2PM, partEdges, renamePerHost));
+  PANDO_CHECK(galois::internal::partitionEdgesParallel(localEdges, v2PM, partEdges, renamePerHost));
 
 #if FREE
   auto freeLocalEdges = +[](PerThreadVector<pando::Vector<EdgeType>> localEdges) {
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#ifndef PANDO_LIB_GALOIS_SYNC_ATOMIC_COMBINER_HPP_
+#define PANDO_LIB_GALOIS_SYNC_ATOMIC_COMBINER_HPP_
+
+#include <pando-rt/export.h>
+
+#include <cstdint>
+
+#include <pando-lib-galois/sync/atomic.hpp>
+#include <pando-rt/memory/global_ptr.hpp>
+#include <pando-rt/sync/atomic.hpp>
+
+namespace galois {
+
+/**
+ * @brief Combines updates with addition
+ */
+template <typename T>
+struct AddCombine {
+  static T combine(T a, T b) noexcept {
+    return a + b;
+  }
+
+  static void apply(pando::GlobalPtr<T> ptr, T value) {
+    pando::atomicFetchAdd(ptr, value, std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @brief Combines updates by keeping the minimum
+ */
+template <typename T>
+struct MinCombine {
+  static T combine(T a, T b) noexcept {
+    return (b < a) ? b : a;
+  }
+
+  static void apply(pando::GlobalPtr<T> ptr, T value) {
+    if constexpr (requires { pando::atomicFetchMin(ptr, value, std::memory_order_relaxed); }) {
+      pando::atomicFetchMin(ptr, value, std::memory_order_relaxed);
+    } else {
+      T expected = pando::atomicLoad(ptr, std::memory_order_relaxed);
+      while (value < expected) {
+        if (pando::atomicCompareExchange(ptr, expected, value, std::memory_order_relaxed,
+                                         std::memory_order_relaxed)) {
+          return;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Combines updates by keeping the maximum
+ */
+template <typename T>
+struct MaxCombine {
+  static T combine(T a, T b) noexcept {
+    return (a < b) ? b : a;
+  }
+
+  static void apply(pando::GlobalPtr<T> ptr, T value) {
+    if constexpr (requires { pando::atomicFetchMax(ptr, value, std::memory_order_relaxed); }) {
+      pando::atomicFetchMax(ptr, value, std::memory_order_relaxed);
+    } else {
+      T expected = pando::atomicLoad(ptr, std::memory_order_relaxed);
+      while (expected < value) {
+        if (pando::atomicCompareExchange(ptr, expected, value, std::memory_order_relaxed,
+                                         std::memory_order_relaxed)) {
+          return;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Buffers commutative atomic updates to global memory and merges the updates to the same
+ * address before sending them
+ *
+ * Pending updates are kept in a small direct-mapped table. An update to an address that is already
+ * pending is combined with it, while an update that maps to an entry of another address sends that
+ * entry first. The remaining updates are sent by flush or on destruction.
+ *
+ * @warning a combiner belongs to a single hart, and updates are only visible after they are sent
+ *
+ * @tparam T       the type of the updated values
+ * @tparam Combine how updates are combined and applied, e.g., AddCombine, MinCombine or MaxCombine
+ * @tparam N       the number of pending updates
+ */
+template <typename T, typename Combine, std::uint64_t N = 16>
+class AtomicCombiner {
+  struct Entry {
+    pando::GlobalPtr<T> ptr = nullptr;
+    T value{};
+  };
+
+  Entry m_entries[N]{};
+
+  static std::uint64_t slot(pando::GlobalPtr<T> ptr) noexcept {
+    return (ptr.address / sizeof(T)) % N;
+  }
+
+public:
+  AtomicCombiner() noexcept = default;
+  AtomicCombiner(const AtomicCombiner&) = delete;
+  AtomicCombiner(AtomicCombiner&&) = delete;
+
+  ~AtomicCombiner() {
+    flush();
+  }
+
+  AtomicCombiner& operator=(const AtomicCombiner&) = delete;
+  AtomicCombiner& operator=(AtomicCombiner&&) = delete;
+
+  /**
+   * @brief adds an update of the object at ptr with value
+   */
+  void update(pando::GlobalPtr<T> ptr, T value) {
+    Entry& entry = m_entries[slot(ptr)];
+    if (entry.ptr == ptr) {
+      entry.value = Combine::combine(entry.value, value);
+      return;
+    }
+    if (entry.ptr != nullptr) {
+      Combine::apply(entry.ptr, entry.value);
+    }
+    entry.ptr = ptr;
+    entry.value = value;
+  }
+
+  /**
+   * @brief sends all pending updates
+   */
+  void flush() {
+    for (Entry& entry : m_entries) {
+      if (entry.ptr != nullptr) {
+        Combine::apply(entry.ptr, entry.value);
+        entry.ptr = nullptr;
+      }
+    }
+  }
+};
+
+} // namespace galois
+
+#endif // PANDO_LIB_GALOIS_SYNC_ATOMIC_COMBINER_HPP_
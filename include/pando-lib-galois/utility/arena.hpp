@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#ifndef PANDO_LIB_GALOIS_UTILITY_ARENA_HPP_
+#define PANDO_LIB_GALOIS_UTILITY_ARENA_HPP_
+
+#include <cstdint>
+
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/memory/allocate_memory.hpp>
+#include <pando-rt/memory/bump_memory_resource.hpp>
+#include <pando-rt/memory/global_ptr.hpp>
+#include <pando-rt/memory/memory_type.hpp>
+#include <pando-rt/status.hpp>
+#include <pando-rt/stddef.hpp>
+
+namespace galois {
+
+/**
+ * @brief Allocator that allocates from the runtime memory resources of a place.
+ *
+ * @note Allocators used by the containers provide `allocate<T>(n)`, which returns `nullptr` on
+ *       failure, and `deallocate<T>(ptr, n)`.
+ */
+struct DefaultAllocator {
+  pando::Place place = pando::anyPlace;
+  pando::MemoryType memoryType = pando::MemoryType::Main;
+
+  template <typename T>
+  [[nodiscard]] pando::GlobalPtr<T> allocate(std::uint64_t n) {
+    auto result = pando::allocateMemory<T>(n, place, memoryType);
+    if (!result.hasValue()) {
+      return nullptr;
+    }
+    return result.value();
+  }
+
+  template <typename T>
+  void deallocate(pando::GlobalPtr<T> ptr, std::uint64_t n) {
+    pando::deallocateMemory(ptr, n);
+  }
+};
+
+/**
+ * @brief A region of memory that hands out short-lived allocations by bumping an offset.
+ *
+ * @details Individual allocations are never freed; everything allocated after a point is released
+ * at once with @ref rewind, @ref reset or at the end of a @ref ScopedRegion. This avoids going
+ * through the slab and free-list resources for every temporary of a task.
+ *
+ * @note An arena is a handle: copies refer to the same memory, so an arena can be passed to tasks.
+ *       Allocation is thread-safe, but rewinding is only safe once no released allocation is
+ *       in use.
+ */
+class Arena {
+  using Resource = pando::BumpMemoryResource<alignof(pando::MaxAlignT)>;
+
+  Resource m_resource;
+  pando::GlobalPtr<std::byte> m_buffer{nullptr};
+  std::uint64_t m_bytes{0};
+  bool m_owned{false};
+
+public:
+  constexpr Arena() noexcept = default;
+
+  /**
+   * @brief Initializes the arena with a buffer of at least @p capacity usable bytes allocated
+   * from @p memoryType memory at @p place.
+   *
+   * @note @ref pando::MemoryType::L1SP cannot be allocated; use the buffer overload with a
+   *       buffer in L1SP instead.
+   */
+  [[nodiscard]] pando::Status initialize(std::uint64_t capacity, pando::Place place,
+                                         pando::MemoryType memoryType) {
+    const std::uint64_t bytes =
+        capacity + Resource::computeMetadataSize() + alignof(pando::MaxAlignT);
+    auto result = pando::allocateMemory<std::byte>(bytes, place, memoryType);
+    if (!result.hasValue()) {
+      return result.error();
+    }
+    const auto status = initialize(result.value(), bytes);
+    if (status != pando::Status::Success) {
+      pando::deallocateMemory(result.value(), bytes);
+      return status;
+    }
+    m_owned = true;
+    return pando::Status::Success;
+  }
+
+  /**
+   * @brief Initializes the arena with a buffer of at least @p capacity usable bytes in
+   * @ref pando::MemoryType::Main memory.
+   */
+  [[nodiscard]] pando::Status initialize(std::uint64_t capacity) {
+    return initialize(capacity, pando::getCurrentPlace(), pando::MemoryType::Main);
+  }
+
+  /**
+   * @brief Initializes the arena over a buffer that the caller owns, e.g. a buffer in L1SP.
+   *
+   * @param[in] buffer start of the buffer
+   * @param[in] bytes  size of the buffer in bytes, including the arena metadata
+   */
+  [[nodiscard]] pando::Status initialize(pando::GlobalPtr<std::byte> buffer, std::uint64_t bytes) {
+    if (buffer == nullptr || bytes <= Resource::computeMetadataSize() + alignof(pando::MaxAlignT)) {
+      return pando::Status::InvalidValue;
+    }
+    m_resource = Resource(buffer, bytes);
+    m_buffer = buffer;
+    m_bytes = bytes;
+    m_owned = false;
+    return pando::Status::Success;
+  }
+
+  /**
+   * @brief Releases the buffer of the arena, if the arena allocated it.
+   */
+  void deinitialize() {
+    if (m_owned) {
+      pando::deallocateMemory(m_buffer, m_bytes);
+    }
+    m_resource = Resource();
+    m_buffer = nullptr;
+    m_bytes = 0;
+    m_owned = false;
+  }
+
+  /**
+   * @brief Allocates space for @p n objects of type @p T.
+   *
+   * @return a pointer to the space or `nullptr` if the arena is exhausted
+   */
+  template <typename T>
+  [[nodiscard]] pando::GlobalPtr<T> allocate(std::uint64_t n) {
+    return static_cast<pando::GlobalPtr<T>>(m_resource.allocate(n * sizeof(T), alignof(T)));
+  }
+
+  /**
+   * @brief Deallocation is a no-op; memory is released by @ref rewind.
+   */
+  template <typename T>
+  void deallocate(pando::GlobalPtr<T>, std::uint64_t) {}
+
+  /**
+   * @brief Allocates a span of @p n objects of type @p T that lives until the arena is rewound.
+   */
+  template <typename T>
+  [[nodiscard]] pando::Status allocateSpan(std::uint64_t n, pando::Span<T>& span) {
+    pando::GlobalPtr<T> ptr = allocate<T>(n);
+    if (ptr == nullptr && n != 0) {
+      return pando::Status::BadAlloc;
+    }
+    span = pando::Span<T>(ptr, n);
+    return pando::Status::Success;
+  }
+
+  /**
+   * @brief Returns a mark that @ref rewind can release back to.
+   */
+  std::uint64_t mark() const {
+    return m_resource.getUsedBytes();
+  }
+
+  /**
+   * @brief Releases every allocation made after @p mark was taken.
+   */
+  void rewind(std::uint64_t mark) {
+    m_resource.rewind(mark);
+  }
+
+  /**
+   * @brief Releases every allocation of the arena.
+   */
+  void reset() {
+    m_resource.rewind(0);
+  }
+};
+
+/**
+ * @brief Releases all the allocations made from an arena during its lifetime.
+ *
+ * @note Regions over the same arena have to be nested.
+ */
+class ScopedRegion {
+  Arena m_arena;
+  std::uint64_t m_mark;
+
+public:
+  explicit ScopedRegion(Arena arena) : m_arena(arena), m_mark(arena.mark()) {}
+
+  ScopedRegion(const ScopedRegion&) = delete;
+  ScopedRegion(ScopedRegion&&) = delete;
+  ScopedRegion& operator=(const ScopedRegion&) = delete;
+  ScopedRegion& operator=(ScopedRegion&&) = delete;
+
+  ~ScopedRegion() {
+    m_arena.rewind(m_mark);
+  }
+};
+
+} // namespace galois
+
+#endif // PANDO_LIB_GALOIS_UTILITY_ARENA_HPP_
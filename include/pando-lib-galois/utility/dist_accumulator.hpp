@@ -15,19 +15,27 @@
 
 #include <pando-lib-galois/containers/dist_array.hpp>
 #include <pando-lib-galois/containers/host_local_storage.hpp>
+#include <pando-lib-galois/containers/thread_local_storage.hpp>
 #include <pando-lib-galois/loops/do_all.hpp>
 #include <pando-lib-galois/sync/atomic.hpp>
+#include <pando-lib-galois/utility/locality.hpp>
 
 namespace galois {
 
 /**
  * @brief This is a basic mechanism for computing distributed atomic values using add and subtract
  * operations
+ *
+ * Like the GAccumulator of Galois, every hart accumulates into its own counter without atomics.
+ * reduce combines the counters as a tree: each host sums the counters of its harts in parallel into
+ * its host counter, and the host counters are then summed into the global value.
  */
 template <typename T>
 class DAccumulator {
   ///@brief This is a local storage of the counters used by each PXN
   galois::HostLocalStorage<T> localCounters{};
+  ///@brief This is a local storage of the counters used by each hart
+  galois::ThreadLocalStorage<T> threadCounters{};
   ///@brief This is a pointer to the computed global value, populated by reduce()
   pando::GlobalPtr<T> globalValue;
   ///@brief Tracks whether global_value holds a valid value
@@ -58,6 +66,12 @@ public:
       pando::deallocateMemory<T>(globalValue, 1);
       return err;
     }
+    err = threadCounters.initialize();
+    if (err != pando::Status::Success) {
+      localCounters.deinitialize();
+      pando::deallocateMemory<T>(globalValue, 1);
+      return err;
+    }
     reset();
     return err;
   }
@@ -77,6 +91,7 @@ public:
    * @warning not threadsafe but designed to be idempotent.
    */
   void deinitialize() {
+    threadCounters.deinitialize();
     localCounters.deinitialize();
     pando::deallocateMemory<T>(globalValue, 1);
   }
@@ -85,9 +100,16 @@ public:
    * @brief resets all local counters to 0 and sets globalValueComputed to false
    */
   void reset() {
-    for (pando::GlobalRef<T> localCounter : localCounters) {
-      localCounter = 0;
-    }
+    PANDO_CHECK(galois::doAll(
+        threadCounters, localCounters,
+        +[](galois::ThreadLocalStorage<T> threadCounters, pando::GlobalRef<T> localCounter) {
+          const std::uint64_t threadsPerHost = galois::getThreadsPerHost();
+          const std::uint64_t begin = pando::getCurrentPlace().node.id * threadsPerHost;
+          for (std::uint64_t i = begin; i < begin + threadsPerHost; i++) {
+            threadCounters[i] = 0;
+          }
+          localCounter = 0;
+        }));
     globalValueComputed = false;
     *globalValue = 0;
     pando::atomicThreadFence(std::memory_order_release);
@@ -96,16 +118,34 @@ public:
   /**
    * @brief reduce adds all local counters together, sets globalValueComputed, and returns the value
    *
+   * The counters of the harts are folded into the counter of their host, so the value is preserved
+   * by subsequent calls.
+   *
    * @warning every time this is called the global value is recomputed, for subsequent access to the
    * globally computed value after the first reduce, use get instead
+   * @warning this must not be called concurrently with add or subtract
    */
   T reduce() {
+    PANDO_CHECK(galois::doAll(
+        threadCounters, localCounters,
+        +[](galois::ThreadLocalStorage<T> threadCounters, pando::GlobalRef<T> localCounter) {
+          const std::uint64_t threadsPerHost = galois::getThreadsPerHost();
+          const std::uint64_t begin = pando::getCurrentPlace().node.id * threadsPerHost;
+          T sum = localCounter;
+          for (std::uint64_t i = begin; i < begin + threadsPerHost; i++) {
+            pando::GlobalRef<T> threadCounter = threadCounters[i];
+            sum += threadCounter;
+            threadCounter = 0;
+          }
+          localCounter = sum;
+        }));
+    T sum = 0;
     for (pando::GlobalRef<T> ref : localCounters) {
-      T val = pando::atomicLoad(&ref, std::memory_order_relaxed);
-      pando::atomicFetchAdd(globalValue, val, std::memory_order_release);
+      sum += pando::atomicLoad(&ref, std::memory_order_acquire);
     }
+    *globalValue = sum;
     globalValueComputed = true;
-    return *globalValue;
+    return sum;
   }
 
   /**
@@ -124,8 +164,14 @@ public:
    * @brief add adds the given delta to the local accumulator
    */
   void add(T delta) {
-    pando::atomicFetchAdd(&localCounters[pando::getCurrentPlace().node.id], delta,
-                          std::memory_order_release);
+    if (pando::isOnCP()) {
+      pando::atomicFetchAdd(&localCounters[pando::getCurrentPlace().node.id], delta,
+                            std::memory_order_release);
+      return;
+    }
+    // only this hart updates its counter
+    pando::GlobalRef<T> threadCounter = threadCounters.getLocalRef();
+    threadCounter = threadCounter + delta;
   }
   /**
    * @brief increment adds 1 to the local accumulator
@@ -137,8 +183,31 @@ public:
    * @brief subtract subtracts the given delta from the local accumulator
    */
   void subtract(T delta) {
-    pando::atomicFetchSub(&localCounters[pando::getCurrentPlace().node.id], delta,
-                          std::memory_order_release);
+    if (pando::isOnCP()) {
+      pando::atomicFetchSub(&localCounters[pando::getCurrentPlace().node.id], delta,
+                            std::memory_order_release);
+      return;
+    }
+    pando::GlobalRef<T> threadCounter = threadCounters.getLocalRef();
+    threadCounter = threadCounter - delta;
+  }
+  /**
+   * @brief flush moves the counter of this hart to the counter of its host
+   *
+   * This is not needed before reduce, which collects the counters of all harts, but makes the
+   * updates of this hart visible to readers of the host counters.
+   */
+  void flush() {
+    if (pando::isOnCP()) {
+      return;
+    }
+    pando::GlobalRef<T> threadCounter = threadCounters.getLocalRef();
+    const T value = threadCounter;
+    if (value != 0) {
+      pando::atomicFetchAdd(&localCounters[pando::getCurrentPlace().node.id], value,
+                            std::memory_order_release);
+      threadCounter = 0;
+    }
   }
   /**
    * @brief decrement subtracts 1 from the local accumulator
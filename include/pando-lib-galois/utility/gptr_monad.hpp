@@ -54,6 +54,8 @@
     *ptrComputed##__LINE__ = tmp;                                                     \
   } while (0)
 
+#include <cstddef>
+
 #include <pando-rt/memory/global_ptr.hpp>
 
 template <typename T, typename F>
@@ -70,4 +72,29 @@ auto applyFunc(pando::GlobalRef<T> ref, F func) {
   return func(obj);
 }
 
+namespace galois {
+
+/**
+ * @brief Returns the offset in bytes of @p member in a @p T
+ *
+ * @warning Like @p offsetof() this is only well defined for standard layout types.
+ */
+template <typename T, typename F>
+std::size_t offsetOfMember(F T::*member) noexcept {
+  alignas(T) std::byte storage[sizeof(T)]{};
+  const T* obj = reinterpret_cast<const T*>(storage);
+  return static_cast<std::size_t>(reinterpret_cast<const std::byte*>(&(obj->*member)) - storage);
+}
+
+/**
+ * @brief Projects a reference to an object onto one of its members, so that accessing the member
+ * only moves the member instead of the whole object
+ */
+template <typename T, typename F>
+pando::GlobalRef<F> fieldOf(pando::GlobalRef<T> ref, F T::*member) noexcept {
+  return *pando::memberPtrOf<F>(&ref, offsetOfMember(member));
+}
+
+} // namespace galois
+
 #endif // PANDO_LIB_GALOIS_UTILITY_GPTR_MONAD_HPP_
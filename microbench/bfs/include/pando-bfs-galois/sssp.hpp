@@ -84,13 +84,14 @@ bool IsactiveIterationEmpty(galois::HostLocalStorage<pando::Vector<T>> phbfs) {
 
 template <typename G>
 void BFSOuterLoop_DLCSR(BFSState<G> state, pando::GlobalRef<typename G::VertexTopologyID> currRef) {
+  auto active = state.active.getAppender();
   for (typename G::EdgeHandle eh : state.graph.edges(currRef)) {
     countEdges.countEdge();
     typename G::VertexTopologyID dst = state.graph.getEdgeDst(eh);
     uint64_t dst_data = state.graph.getData(dst);
     if (dst_data == UINT64_MAX) {
       state.graph.setData(dst, state.dist);
-      PANDO_CHECK(state.active.pushBack(dst));
+      PANDO_CHECK(active.pushBack(dst));
     }
   }
 }
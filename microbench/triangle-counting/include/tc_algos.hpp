@@ -19,6 +19,9 @@ template <typename GraphType>
 void tc_chunk_vertices(pando::GlobalPtr<GraphType> graph_ptr,
                        galois::DAccumulator<uint64_t> final_tri_count);
 
+void tc_compressed(pando::GlobalPtr<GraphDL> graph_ptr,
+                   galois::DAccumulator<uint64_t> final_tri_count);
+
 void HBMainTC(pando::Array<char> filename, int64_t num_vertices, bool load_balanced_graph,
               TC_CHUNK tc_chunk, galois::DAccumulator<uint64_t> final_tri_count);
 
@@ -13,6 +13,7 @@
 
 #include <pando-lib-galois/containers/host_local_storage.hpp>
 #include <pando-lib-galois/containers/pod_local_storage.hpp>
+#include <pando-lib-galois/graphs/compressed_adjacency.hpp>
 #include <pando-lib-galois/graphs/dist_array_csr.hpp>
 #include <pando-lib-galois/graphs/dist_local_csr.hpp>
 #include <pando-lib-galois/graphs/edge_list_importer.hpp>
@@ -35,7 +36,7 @@ using VT = galois::ELVertex;
 using GraphDL = galois::DistLocalCSR<VT, ET>;
 using GraphDA = galois::DistArrayCSR<VT, ET>;
 
-enum TC_CHUNK { NO_CHUNK = 0, CHUNK_VERTICES = 1, CHUNK_EDGES = 2 };
+enum TC_CHUNK { NO_CHUNK = 0, CHUNK_VERTICES = 1, CHUNK_EDGES = 2, COMPRESSED = 3 };
 
 struct CommandLineOptions {
   std::string elFile;
@@ -202,6 +202,52 @@ void tc_chunk_vertices(pando::GlobalPtr<GraphDL> graph_ptr,
   per_host_iterator_offsets.deinitialize();
 }
 
+/**
+ * @brief Runs Triangle Counting on a compressed copy of the adjacency of a DistLocalCSR (GraphDL),
+ * intersecting the sorted neighbor indices of its varint codes instead of the edges of the graph
+ *
+ * @param[in] graph_ptr Pointer to the in-memory graph
+ * @param[in] final_tri_count Thread-safe counter
+ */
+void tc_compressed(pando::GlobalPtr<GraphDL> graph_ptr,
+                   galois::DAccumulator<uint64_t> final_tri_count) {
+  GraphDL graph = *graph_ptr;
+  galois::CompressedAdjacency adj;
+  PANDO_CHECK(adj.initialize(graph));
+
+  auto state = galois::make_tpl(graph_ptr, adj, final_tri_count);
+  galois::doAll(
+      state, graph.vertices(), +[](decltype(state) state, typename GraphDL::VertexTopologyID v0) {
+        auto [graph_ptr, adj, final_tri_count] = state;
+        GraphDL graph = *graph_ptr;
+
+        // Degree Filtering Optimization
+        uint64_t v0_degree = graph.getNumEdges(v0);
+        if (v0_degree < (TC_EMBEDDING_SZ - 1))
+          return;
+
+        uint64_t count = 0;
+        auto v0_edges = adj.edges(graph.getVertexIndex(v0));
+        for (uint64_t v1 : v0_edges) {
+          auto v1_edges = adj.edges(v1);
+          auto p_it = v0_edges.begin();
+          auto q_it = v1_edges.begin();
+          while (p_it != v0_edges.end() && q_it != v1_edges.end()) {
+            uint64_t a = *p_it;
+            uint64_t b = *q_it;
+            if (a <= b)
+              p_it++;
+            if (a >= b)
+              q_it++;
+            if (a == b)
+              count++;
+          }
+        }
+        final_tri_count.add(count);
+      });
+  adj.deinitialize();
+}
+
 // #####################################################################
 //                        TC GRAPH HBMAINS
 // #####################################################################
@@ -237,6 +283,9 @@ void HBGraphDL(pando::Place thisPlace, pando::Array<char> filename, int64_t num_
     case TC_CHUNK::CHUNK_VERTICES:
       tc_chunk_vertices(graph_ptr, final_tri_count);
       break;
+    case TC_CHUNK::COMPRESSED:
+      tc_compressed(graph_ptr, final_tri_count);
+      break;
     /**
     case TC_CHUNK::CHUNK_EDGES:
       tc_chunk_edges(graph_ptr, final_tri_count);
@@ -37,6 +37,9 @@ std::unique_ptr<CommandLineOptions> read_cmd_line_args(int argc, char** argv) {
           case 2:
             opts_ptr->tc_chunk = CHUNK_EDGES;
             break;
+          case 3:
+            opts_ptr->tc_chunk = COMPRESSED;
+            break;
           default:
             printUsageExit(argv[0]);
         }
@@ -64,7 +67,7 @@ std::unique_ptr<CommandLineOptions> read_cmd_line_args(int argc, char** argv) {
 void printUsage(char* argv0) {
   std::cerr << "Usage: " << argv0 << " -i filepath -v numVertices" << std::endl;
   std::cerr << "\n Can specify runtime algorithm with -c. Valid options: [0 (NO_CHUNK), 1 "
-               "(CHUNK_EDGES), 2 (CHUNK_VERTICES)]\n";
+               "(CHUNK_EDGES), 2 (CHUNK_VERTICES), 3 (COMPRESSED)]\n";
 }
 
 void printUsageExit(char* argv0) {
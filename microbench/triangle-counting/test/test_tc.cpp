@@ -46,7 +46,9 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("/pando/graphs/rmat_571919_seed1_scale5_nV32_nE153.el", 32,
                                       401, TC_CHUNK::CHUNK_VERTICES),
                       std::make_tuple("/pando/graphs/rmat_571919_seed1_scale5_nV32_nE153.el", 32,
-                                      401, TC_CHUNK::CHUNK_EDGES)));
+                                      401, TC_CHUNK::CHUNK_EDGES),
+                      std::make_tuple("/pando/graphs/rmat_571919_seed1_scale5_nV32_nE153.el", 32,
+                                      401, TC_CHUNK::COMPRESSED)));
 
 // Chunking not avail for DACSR
 class TriangleCountDACSR
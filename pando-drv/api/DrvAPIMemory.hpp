@@ -6,6 +6,7 @@
 #include <DrvAPIAddress.hpp>
 #include <DrvAPIAddressToNative.hpp>
 #include <DrvAPIThread.hpp>
+#include <type_traits>
 
 namespace DrvAPI
 {
@@ -72,7 +73,7 @@ T atomic_add(DrvAPIAddress address, T value)
 }
 
 /**
- * @brief atomic add to a memory address
+ * @brief atomic or to a memory address
  */
 template <typename T>
 T atomic_or(DrvAPIAddress address, T value)
@@ -87,6 +88,60 @@ T atomic_or(DrvAPIAddress address, T value)
     return result;
 }
 
+/**
+ * @brief atomic and to a memory address
+ */
+template <typename T>
+T atomic_and(DrvAPIAddress address, T value)
+{
+    T result = 0;
+    DrvAPIThread::current()->setState(std::make_shared<DrvAPIMemAtomicConcrete<T, DrvAPIMemAtomicAND>>(address, value));
+    DrvAPIThread::current()->yield();
+    auto atomic_req = std::dynamic_pointer_cast<DrvAPIMemAtomic>(DrvAPIThread::current()->getState());
+    if (atomic_req) {
+        atomic_req->getResult(&result);
+    }
+    return result;
+}
+
+/**
+ * @brief atomic minimum to a memory address
+ *
+ * Signed types are compared as signed integers, unsigned types as unsigned integers.
+ */
+template <typename T>
+T atomic_min(DrvAPIAddress address, T value)
+{
+    constexpr DrvAPIMemAtomicType OP = std::is_signed<T>::value ? DrvAPIMemAtomicMIN : DrvAPIMemAtomicMINU;
+    T result = 0;
+    DrvAPIThread::current()->setState(std::make_shared<DrvAPIMemAtomicConcrete<T, OP>>(address, value));
+    DrvAPIThread::current()->yield();
+    auto atomic_req = std::dynamic_pointer_cast<DrvAPIMemAtomic>(DrvAPIThread::current()->getState());
+    if (atomic_req) {
+        atomic_req->getResult(&result);
+    }
+    return result;
+}
+
+/**
+ * @brief atomic maximum to a memory address
+ *
+ * Signed types are compared as signed integers, unsigned types as unsigned integers.
+ */
+template <typename T>
+T atomic_max(DrvAPIAddress address, T value)
+{
+    constexpr DrvAPIMemAtomicType OP = std::is_signed<T>::value ? DrvAPIMemAtomicMAX : DrvAPIMemAtomicMAXU;
+    T result = 0;
+    DrvAPIThread::current()->setState(std::make_shared<DrvAPIMemAtomicConcrete<T, OP>>(address, value));
+    DrvAPIThread::current()->yield();
+    auto atomic_req = std::dynamic_pointer_cast<DrvAPIMemAtomic>(DrvAPIThread::current()->getState());
+    if (atomic_req) {
+        atomic_req->getResult(&result);
+    }
+    return result;
+}
+
 /**
  * @brief atomic compare and swap to a memory address
  */
@@ -9,6 +9,7 @@
 #include <utility>
 #include <tuple>
 #include <iostream>
+#include <type_traits>
 namespace DrvAPI {
 
 typedef enum  {
@@ -16,6 +17,11 @@ typedef enum  {
     DrvAPIMemAtomicSWAP,
     DrvAPIMemAtomicADD,
     DrvAPIMemAtomicOR,
+    DrvAPIMemAtomicAND,
+    DrvAPIMemAtomicMIN,
+    DrvAPIMemAtomicMAX,
+    DrvAPIMemAtomicMINU,
+    DrvAPIMemAtomicMAXU,
 } DrvAPIMemAtomicType;
 
 /**
@@ -42,6 +48,9 @@ inline bool DrvAPIMemAtomicTypeHasExt(DrvAPIMemAtomicType op)
 template <typename IntType>
 std::pair<IntType,IntType>
 atomic_modify(IntType w, IntType r, DrvAPIMemAtomicType op) {
+    // MIN/MAX compare as signed integers and MINU/MAXU as unsigned integers, like RISC-V AMOs
+    using SInt = typename std::make_signed<IntType>::type;
+    using UInt = typename std::make_unsigned<IntType>::type;
     switch (op) {
     case DrvAPIMemAtomicSWAP:
         return {w, r};
@@ -49,6 +58,16 @@ atomic_modify(IntType w, IntType r, DrvAPIMemAtomicType op) {
         return {w + r, r};
     case DrvAPIMemAtomicOR:
         return {w | r, r};
+    case DrvAPIMemAtomicAND:
+        return {w & r, r};
+    case DrvAPIMemAtomicMIN:
+        return {static_cast<SInt>(w) < static_cast<SInt>(r) ? w : r, r};
+    case DrvAPIMemAtomicMAX:
+        return {static_cast<SInt>(w) > static_cast<SInt>(r) ? w : r, r};
+    case DrvAPIMemAtomicMINU:
+        return {static_cast<UInt>(w) < static_cast<UInt>(r) ? w : r, r};
+    case DrvAPIMemAtomicMAXU:
+        return {static_cast<UInt>(w) > static_cast<UInt>(r) ? w : r, r};
     default:
         assert(false && "Something went wrong");
     }
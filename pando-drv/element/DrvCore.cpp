@@ -15,6 +15,9 @@
 #include <cstring>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cinttypes>
+#include <mutex>
 
 using namespace SST;
 using namespace Drv;
@@ -153,11 +156,13 @@ void DrvCore::configureThreads(SST::Params &params) {
     configureThread(thread, threads);
   done_ = threads;
   last_thread_ = threads - 1;
+  ready_threads_.resize(threads);
 }
 
 void DrvCore::startThreads() {
     for (auto& thread : threads_) {
         thread.getAPIThread().start();
+        ready_threads_.set(getThreadID(&thread));
     }
 }
 
@@ -202,138 +207,103 @@ void DrvCore::configureOtherLinks(SST::Params &params) {
     loopback_->addSendLatency(1, "ns");
 }
 
+namespace {
+// the per-phase statistics of all cores in a process go to one file
+std::mutex phase_stats_mutex;
+std::unique_ptr<SST::Output> phase_stats_output;
+
+const char *const phase_thread_stat_names[DrvCore::NUM_PHASE_THREAD_STATS] = {
+    "load_l1sp",
+    "store_l1sp",
+    "atomic_l1sp",
+    "load_l2sp",
+    "store_l2sp",
+    "atomic_l2sp",
+    "load_dram",
+    "store_dram",
+    "atomic_dram",
+    "load_remote_pxn",
+    "store_remote_pxn",
+    "atomic_remote_pxn",
+    "stall_cycles_when_ready",
+};
+
+const char *const phase_core_stat_names[DrvCore::NUM_PHASE_CORE_STATS] = {
+    "busy_cycles",
+    "stall_cycles",
+};
+}
+
 /**
  * configure phase statistics
+ * counters of a phase are allocated the first time the phase has activity
  */
-void DrvCore::configurePhaseStatistics() {
+void DrvCore::configurePhaseStatistics(SST::Params &params) {
     output_->verbose(CALL_INFO, 1, DEBUG_INIT, "configuring phase statistics\n");
+    phase_stats_on_ = params.find<bool>("phase_stats", false);
+    phase_stats_file_ = params.find<std::string>("phase_stats_file", "phase_stats.csv");
+    if (getNumRanks().rank > 1) {
+        phase_stats_file_ += "." + std::to_string(getRank().rank);
+    }
+    phase_stats_.resize(phase_max_);
+}
 
-    for (int phase = 0; phase < phase_max_; phase++) {
-      std::vector<ThreadStat> phase_comp_thread_stats;
-      phase_comp_thread_stats.resize(num_threads_);
-      for (int thread = 0; thread < num_threads_; thread++) {
-          ThreadStat *thread_stat = &phase_comp_thread_stats[thread];
-          std::string subid = "phase_" + std::to_string(phase) + "_thread_" + std::to_string(thread);
-          thread_stat->load_l1sp = registerStatistic<uint64_t>("phase_comp_load_l1sp", subid);
-          thread_stat->load_l2sp = registerStatistic<uint64_t>("phase_comp_load_l2sp", subid);
-          thread_stat->load_dram = registerStatistic<uint64_t>("phase_comp_load_dram", subid);
-          thread_stat->load_remote_pxn = registerStatistic<uint64_t>("phase_comp_load_remote_pxn", subid);
-          thread_stat->store_l1sp = registerStatistic<uint64_t>("phase_comp_store_l1sp", subid);
-          thread_stat->store_l2sp = registerStatistic<uint64_t>("phase_comp_store_l2sp", subid);
-          thread_stat->store_dram = registerStatistic<uint64_t>("phase_comp_store_dram", subid);
-          thread_stat->store_remote_pxn = registerStatistic<uint64_t>("phase_comp_store_remote_pxn", subid);
-          thread_stat->atomic_l1sp = registerStatistic<uint64_t>("phase_comp_atomic_l1sp", subid);
-          thread_stat->atomic_l2sp = registerStatistic<uint64_t>("phase_comp_atomic_l2sp", subid);
-          thread_stat->atomic_dram = registerStatistic<uint64_t>("phase_comp_atomic_dram", subid);
-          thread_stat->atomic_remote_pxn = registerStatistic<uint64_t>("phase_comp_atomic_remote_pxn", subid);
-          thread_stat->stall_cycles_when_ready = registerStatistic<uint64_t>("phase_comp_stall_cycles_when_ready", subid);
-          thread_stat->tag_cycles = registerStatistic<uint64_t>("phase_comp_tag_cycles", subid);
-
-          thread_stat->load_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->load_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->load_dram->setFlagResetCountOnOutput(true);
-          thread_stat->load_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->store_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->store_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->store_dram->setFlagResetCountOnOutput(true);
-          thread_stat->store_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_dram->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->stall_cycles_when_ready->setFlagResetCountOnOutput(true);
-          thread_stat->tag_cycles->setFlagResetCountOnOutput(true);
-
-          thread_stat->load_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->load_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->load_dram->setFlagClearDataOnOutput(true);
-          thread_stat->load_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->store_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->store_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->store_dram->setFlagClearDataOnOutput(true);
-          thread_stat->store_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_dram->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->stall_cycles_when_ready->setFlagClearDataOnOutput(true);
-          thread_stat->tag_cycles->setFlagClearDataOnOutput(true);
-      }
-      per_phase_comp_thread_stats_.push_back(phase_comp_thread_stats);
-
-      std::vector<ThreadStat> phase_comm_thread_stats;
-      phase_comm_thread_stats.resize(num_threads_);
-      for (int thread = 0; thread < num_threads_; thread++) {
-          ThreadStat *thread_stat = &phase_comm_thread_stats[thread];
-          std::string subid = "phase_" + std::to_string(phase) + "_thread_" + std::to_string(thread);
-          thread_stat->load_l1sp = registerStatistic<uint64_t>("phase_comm_load_l1sp", subid);
-          thread_stat->load_l2sp = registerStatistic<uint64_t>("phase_comm_load_l2sp", subid);
-          thread_stat->load_dram = registerStatistic<uint64_t>("phase_comm_load_dram", subid);
-          thread_stat->load_remote_pxn = registerStatistic<uint64_t>("phase_comm_load_remote_pxn", subid);
-          thread_stat->store_l1sp = registerStatistic<uint64_t>("phase_comm_store_l1sp", subid);
-          thread_stat->store_l2sp = registerStatistic<uint64_t>("phase_comm_store_l2sp", subid);
-          thread_stat->store_dram = registerStatistic<uint64_t>("phase_comm_store_dram", subid);
-          thread_stat->store_remote_pxn = registerStatistic<uint64_t>("phase_comm_store_remote_pxn", subid);
-          thread_stat->atomic_l1sp = registerStatistic<uint64_t>("phase_comm_atomic_l1sp", subid);
-          thread_stat->atomic_l2sp = registerStatistic<uint64_t>("phase_comm_atomic_l2sp", subid);
-          thread_stat->atomic_dram = registerStatistic<uint64_t>("phase_comm_atomic_dram", subid);
-          thread_stat->atomic_remote_pxn = registerStatistic<uint64_t>("phase_comm_atomic_remote_pxn", subid);
-          thread_stat->stall_cycles_when_ready = registerStatistic<uint64_t>("phase_comm_stall_cycles_when_ready", subid);
-          thread_stat->tag_cycles = registerStatistic<uint64_t>("phase_comm_tag_cycles", subid);
-
-          thread_stat->load_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->load_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->load_dram->setFlagResetCountOnOutput(true);
-          thread_stat->load_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->store_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->store_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->store_dram->setFlagResetCountOnOutput(true);
-          thread_stat->store_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_l1sp->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_l2sp->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_dram->setFlagResetCountOnOutput(true);
-          thread_stat->atomic_remote_pxn->setFlagResetCountOnOutput(true);
-          thread_stat->stall_cycles_when_ready->setFlagResetCountOnOutput(true);
-          thread_stat->tag_cycles->setFlagResetCountOnOutput(true);
-
-          thread_stat->load_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->load_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->load_dram->setFlagClearDataOnOutput(true);
-          thread_stat->load_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->store_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->store_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->store_dram->setFlagClearDataOnOutput(true);
-          thread_stat->store_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_l1sp->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_l2sp->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_dram->setFlagClearDataOnOutput(true);
-          thread_stat->atomic_remote_pxn->setFlagClearDataOnOutput(true);
-          thread_stat->stall_cycles_when_ready->setFlagClearDataOnOutput(true);
-          thread_stat->tag_cycles->setFlagClearDataOnOutput(true);
-      }
-      per_phase_comm_thread_stats_.push_back(phase_comm_thread_stats);
-
-      Statistic<uint64_t> *phase_busy_cycles;
-      Statistic<uint64_t> *phase_stall_cycles;
-      std::string subid = "phase_" + std::to_string(phase);
-      phase_busy_cycles = registerStatistic<uint64_t>("phase_busy_cycles", subid);
-      phase_stall_cycles = registerStatistic<uint64_t>("phase_stall_cycles", subid);
-
-      phase_busy_cycles->setFlagResetCountOnOutput(true);
-      phase_stall_cycles->setFlagResetCountOnOutput(true);
+/**
+ * write the non-zero counters of the active phases and reset them
+ */
+void DrvCore::writePhaseStatistics() {
+    if (!phase_stats_on_) {
+        return;
+    }
+    output_->verbose(CALL_INFO, 1, DEBUG_CLK, "writing phase statistics\n");
 
-      phase_busy_cycles->setFlagClearDataOnOutput(true);
-      phase_stall_cycles->setFlagClearDataOnOutput(true);
+    std::lock_guard<std::mutex> lock(phase_stats_mutex);
+    if (!phase_stats_output) {
+        phase_stats_output = std::make_unique<SST::Output>("", 0, 0, Output::FILE, phase_stats_file_);
+        phase_stats_output->output("Phase,Component,Stage,Thread,StatisticName,Count\n");
+    }
 
-      per_phase_busy_cycles_.push_back(phase_busy_cycles);
-      per_phase_stall_cycles_.push_back(phase_stall_cycles);
+    const char *stage_names[2] = {"comp", "comm"};
+    for (int phase = 0; phase < phase_max_; phase++) {
+        std::vector<uint64_t> &stats = phase_stats_[phase];
+        if (stats.empty()) {
+            continue;
+        }
+        uint64_t phase_id = phase_round_ * phase_max_ + phase;
+        for (int stage = 0; stage < 2; stage++) {
+            for (int thread = 0; thread < num_threads_; thread++) {
+                const uint64_t *thread_stats = &stats[(stage * num_threads_ + thread) * NUM_PHASE_THREAD_STATS];
+                for (int stat = 0; stat < NUM_PHASE_THREAD_STATS; stat++) {
+                    if (thread_stats[stat] != 0) {
+                        phase_stats_output->output("%" PRIu64 ",%s,%s,%d,%s,%" PRIu64 "\n"
+                                                   ,phase_id
+                                                   ,getName().c_str()
+                                                   ,stage_names[stage]
+                                                   ,thread
+                                                   ,phase_thread_stat_names[stat]
+                                                   ,thread_stats[stat]);
+                    }
+                }
+            }
+        }
+        const uint64_t *core_stats = &stats[2 * num_threads_ * NUM_PHASE_THREAD_STATS];
+        for (int stat = 0; stat < NUM_PHASE_CORE_STATS; stat++) {
+            if (core_stats[stat] != 0) {
+                phase_stats_output->output("%" PRIu64 ",%s,,,%s,%" PRIu64 "\n"
+                                           ,phase_id
+                                           ,getName().c_str()
+                                           ,phase_core_stat_names[stat]
+                                           ,core_stats[stat]);
+            }
+        }
+        std::fill(stats.begin(), stats.end(), 0);
     }
 }
 
 /**
  * configure statistics
  */
-void DrvCore::configureStatistics() {
+void DrvCore::configureStatistics(SST::Params &params) {
     output_->verbose(CALL_INFO, 1, DEBUG_INIT, "configuring statistics\n");
     uint32_t stats_level = getStatisticLoadLevel();
     tag_.init("", stats_level, 0, Output::FILE, "tags.csv");
@@ -361,7 +331,7 @@ void DrvCore::configureStatistics() {
     total_busy_cycles_ = registerStatistic<uint64_t>("total_busy_cycles");
     total_stall_cycles_ = registerStatistic<uint64_t>("total_stall_cycles");
 
-    DrvCore::configurePhaseStatistics();
+    DrvCore::configurePhaseStatistics(params);
 }
 
 /**
@@ -405,6 +375,8 @@ DrvCore::DrvCore(SST::ComponentId_t id, SST::Params& params)
   , core_on_(false)
   , stage_(DrvAPI::stage_t::STAGE_OTHER)
   , phase_(0)
+  , phase_round_(0)
+  , phase_stats_on_(false)
   , stat_dump_cnt_(0)
   , system_callbacks_(std::make_shared<DrvSystem>(*this)) {
   id_ = params.find<int>("id", 0);
@@ -421,7 +393,7 @@ DrvCore::DrvCore(SST::ComponentId_t id, SST::Params& params)
   configureMemory(params);
   configureOtherLinks(params);
   configureExecutable(params);
-  configureStatistics();
+  configureStatistics(params);
   parseArgv(params);
   configureThreads(params);
   setSysConfigApp();
@@ -467,6 +439,7 @@ void DrvCore::setup() {
  * finish the component
  */
 void DrvCore::finish() {
+  writePhaseStatistics();
   threads_.clear();
   auto stdmem = dynamic_cast<DrvStdMemory*>(memory_);
   if (stdmem) {
@@ -481,38 +454,21 @@ static constexpr int NO_THREAD_READY = -1;
 
 int DrvCore::selectReadyThread() {
   // select a ready thread to execute
-
-  bool selected = false;
-  int return_thread_id = NO_THREAD_READY;
-  for (int t = 0; t < numThreads(); t++) {
-    int thread_id = (last_thread_ + t + 1) % numThreads();
-    DrvThread *thread = getThread(thread_id);
-    auto & state = thread->getAPIThread().getState();
-
-    if (state->canResume()) {
-      if (!selected) {
-        output_->verbose(CALL_INFO, 2, DEBUG_CLK, "thread %d is ready\n", thread_id);
-        selected = true;
-        return_thread_id =  thread_id;
-      } else {
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP) {
-          ThreadStat *total_stats = &total_thread_stats_[t];
-          ThreadStat *phase_stats = &(per_phase_comp_thread_stats_[phase_][t]);
-          total_stats->stall_cycles_when_ready->addData(1);
-          phase_stats->stall_cycles_when_ready->addData(1);
-        }
-        else if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
-          ThreadStat *total_stats = &total_thread_stats_[t];
-          ThreadStat *phase_stats = &(per_phase_comm_thread_stats_[phase_][t]);
-          total_stats->stall_cycles_when_ready->addData(1);
-          phase_stats->stall_cycles_when_ready->addData(1);
-        }
-      }
-    }
-  }
-
-  if (!selected) {
+  int return_thread_id = ready_threads_.next(last_thread_);
+  if (return_thread_id == DrvReadyMask::NONE) {
     output_->verbose(CALL_INFO, 2, DEBUG_CLK, "no thread is ready\n");
+    return NO_THREAD_READY;
+  }
+  output_->verbose(CALL_INFO, 2, DEBUG_CLK, "thread %d is ready\n", return_thread_id);
+
+  // the other ready threads stall this cycle
+  if (isStatStage()) {
+    ready_threads_.forEach([this, return_thread_id](int thread_id) {
+      if (thread_id != return_thread_id) {
+        total_thread_stats_[thread_id].stall_cycles_when_ready->addData(1);
+        addPhaseThreadStat(thread_id, PHASE_STALL_CYCLES_WHEN_READY);
+      }
+    });
   }
   return return_thread_id;
 }
@@ -528,8 +484,11 @@ void DrvCore::executeReadyThread() {
   idle_cycles_ = 0;
 
   // execute the ready thread
-  threads_[thread_id].execute(this);
+  DrvThread &thread = threads_[thread_id];
+  thread.execute(this);
   last_thread_ = thread_id;
+  // requests that completed while handling the yield leave the thread ready
+  ready_threads_.set(thread_id, thread.getAPIThread().getState()->canResume());
 
   addBusyCycleStat(1);
 }
@@ -559,6 +518,10 @@ void DrvCore::handleThreadStateAfterYield(DrvThread *thread) {
   if (increment_phase_req) {
     output_->verbose(CALL_INFO, 1, DEBUG_CLK, "phase increment\n");
     phase_ = (phase_ + 1) % phase_max_;
+    if (phase_ == 0) {
+      writePhaseStatistics();
+      phase_round_++;
+    }
 
     // only one command processor outputs phase statistic
     if (pxn_ == 0 && pod_ == 0 && id_ == -1) {
@@ -647,6 +610,7 @@ void DrvCore::handleLoopback(SST::Event *event) {
       output_->fatal(CALL_INFO, -1, "loopback event is not a nop\n");
     }
     nop->complete();
+    markThreadReady(thread);
     assertCoreOn();
     delete event;
     return;
@@ -7,6 +7,8 @@
 #include <sst/core/interfaces/stdMem.h>
 #include <sst/core/event.h>
 #include <memory>
+#include <string>
+#include <vector>
 #include "DrvEvent.hpp"
 #include "DrvMemory.hpp"
 #include "DrvThread.hpp"
@@ -14,6 +16,7 @@
 #include "DrvSysConfig.hpp"
 #include "DrvAPIMain.hpp"
 #include "DrvStats.hpp"
+#include "DrvReadyMask.hpp"
 #include <DrvAPI.hpp>
 namespace SST {
 namespace Drv {
@@ -46,7 +49,9 @@ public:
       {"id", "ID for the core", "0"},
       {"pod", "Pod ID of this core", "0"},
       {"pxn", "PXN ID of this core", "0"},
-      {"phase_max", "Number of preallocated phases for statistic", "1"},
+      {"phase_max", "Number of phases after which per-phase statistics are written", "1"},
+      {"phase_stats", "Collect per-phase statistics", "false"},
+      {"phase_stats_file", "File for per-phase statistics of active phases", "phase_stats.csv"},
       {"stack_in_l1sp", "Use modeled memory backing store for stack", "0"},
       {"dram_base", "Base address of DRAM", "0x80000000"},
       {"dram_size", "Size of DRAM", "0x100000000"},
@@ -93,6 +98,35 @@ public:
       Statistic<uint64_t> *tag_cycles; // cycles spent executing with a tag
   };
 
+  /**
+   * per-thread counters of a phase
+   */
+  enum PhaseThreadStat {
+      PHASE_LOAD_L1SP,
+      PHASE_STORE_L1SP,
+      PHASE_ATOMIC_L1SP,
+      PHASE_LOAD_L2SP,
+      PHASE_STORE_L2SP,
+      PHASE_ATOMIC_L2SP,
+      PHASE_LOAD_DRAM,
+      PHASE_STORE_DRAM,
+      PHASE_ATOMIC_DRAM,
+      PHASE_LOAD_REMOTE_PXN,
+      PHASE_STORE_REMOTE_PXN,
+      PHASE_ATOMIC_REMOTE_PXN,
+      PHASE_STALL_CYCLES_WHEN_READY,
+      NUM_PHASE_THREAD_STATS
+  };
+
+  /**
+   * per-core counters of a phase
+   */
+  enum PhaseCoreStat {
+      PHASE_BUSY_CYCLES,
+      PHASE_STALL_CYCLES,
+      NUM_PHASE_CORE_STATS
+  };
+
   static constexpr uint32_t TAG_EXECUTION_LOAD_LEVEL = 3;
 
   // DOCUMENT STATISTICS
@@ -113,36 +147,6 @@ public:
       {"total_tag_cycles", "number of cycles spent executing with a tag", "count", 1},
       {"total_stall_cycles", "Number of stalled cycles", "count", 1},
       {"total_busy_cycles", "Number of busy cycles", "count", 1},
-      {"phase_comp_load_l1sp", "Number of loads to local L1SP", "count", 1},
-      {"phase_comp_store_l1sp", "Number of stores to local L1SP", "count", 1},
-      {"phase_comp_atomic_l1sp", "Number of atomics to local L1SP", "count", 1},
-      {"phase_comp_load_l2sp", "Number of loads to L2SP", "count", 1},
-      {"phase_comp_store_l2sp", "Number of stores to L2SP", "count", 1},
-      {"phase_comp_atomic_l2sp", "Number of atomics to L2SP", "count", 1},
-      {"phase_comp_load_dram", "Number of loads to DRAM", "count", 1},
-      {"phase_comp_store_dram", "Number of stores to DRAM", "count", 1},
-      {"phase_comp_atomic_dram", "Number of atomics to DRAM", "count", 1},
-      {"phase_comp_load_remote_pxn", "Number of loads to remote PXN", "count", 1},
-      {"phase_comp_store_remote_pxn", "Number of stores to remote PXN", "count", 1},
-      {"phase_comp_atomic_remote_pxn", "Number of atomics to remote PXN", "count", 1},
-      {"phase_comp_stall_cycles_when_ready", "Number of cycles stalled when a thread is ready", "count", 1},
-      {"phase_comp_tag_cycles", "number of cycles spent executing with a tag", "count", 1},
-      {"phase_comm_load_l1sp", "Number of loads to local L1SP", "count", 1},
-      {"phase_comm_store_l1sp", "Number of stores to local L1SP", "count", 1},
-      {"phase_comm_atomic_l1sp", "Number of atomics to local L1SP", "count", 1},
-      {"phase_comm_load_l2sp", "Number of loads to L2SP", "count", 1},
-      {"phase_comm_store_l2sp", "Number of stores to L2SP", "count", 1},
-      {"phase_comm_atomic_l2sp", "Number of atomics to L2SP", "count", 1},
-      {"phase_comm_load_dram", "Number of loads to DRAM", "count", 1},
-      {"phase_comm_store_dram", "Number of stores to DRAM", "count", 1},
-      {"phase_comm_atomic_dram", "Number of atomics to DRAM", "count", 1},
-      {"phase_comm_load_remote_pxn", "Number of loads to remote PXN", "count", 1},
-      {"phase_comm_store_remote_pxn", "Number of stores to remote PXN", "count", 1},
-      {"phase_comm_atomic_remote_pxn", "Number of atomics to remote PXN", "count", 1},
-      {"phase_comm_stall_cycles_when_ready", "Number of cycles stalled when a thread is ready", "count", 1},
-      {"phase_comm_tag_cycles", "number of cycles spent executing with a tag", "count", 1},
-      {"phase_stall_cycles", "Number of stalled cycles", "count", 1},
-      {"phase_busy_cycles", "Number of busy cycles", "count", 1},
     )
 
   /**
@@ -217,13 +221,15 @@ public:
 
   /**
    * configure phase statistics
+   * @param[in] params Parameters to this component.
    */
-  void configurePhaseStatistics();
+  void configurePhaseStatistics(SST::Params &params);
 
   /**
    * configure statistics
+   * @param[in] params Parameters to this component.
    */
-  void configureStatistics();
+  void configureStatistics(SST::Params &params);
 
   /**
    * select a ready thread
@@ -371,7 +377,16 @@ public:
    * return true if we should unregister the clock
    */
   bool shouldUnregisterClock() {
-    return allDone() || (idle_cycles_ >= max_idle_cycles_);
+    // with no ready thread, only a response or loopback event can wake a thread
+    return allDone() || !ready_threads_.any() || (idle_cycles_ >= max_idle_cycles_);
+  }
+
+  /**
+   * mark a thread as ready after its request completed
+   * the caller must turn the core on with assertCoreOn()
+   */
+  void markThreadReady(DrvThread *thread) {
+    ready_threads_.set(getThreadID(thread));
   }
 
   /**
@@ -427,46 +442,67 @@ public:
         return addr.pxn() != static_cast<uint64_t>(pxn_);
     }
 
+    /**
+     * return true if statistics are collected in the current stage
+     */
+    bool isStatStage() const {
+        return stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP || stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM;
+    }
+
+    /**
+     * return the counters of the current phase, allocating them the first time the phase is active
+     */
+    uint64_t *currentPhaseStats() {
+        std::vector<uint64_t> &stats = phase_stats_[phase_];
+        if (stats.empty()) {
+            stats.resize(2 * num_threads_ * NUM_PHASE_THREAD_STATS + NUM_PHASE_CORE_STATS, 0);
+        }
+        return stats.data();
+    }
+
+    /**
+     * add to a per-thread counter of the current phase and stage
+     */
+    void addPhaseThreadStat(int tid, PhaseThreadStat stat, uint64_t count = 1) {
+        if (!phase_stats_on_) {
+            return;
+        }
+        int stage = (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP) ? 0 : 1;
+        currentPhaseStats()[(stage * num_threads_ + tid) * NUM_PHASE_THREAD_STATS + stat] += count;
+    }
+
+    /**
+     * add to a per-core counter of the current phase
+     */
+    void addPhaseCoreStat(PhaseCoreStat stat, uint64_t count) {
+        if (!phase_stats_on_) {
+            return;
+        }
+        currentPhaseStats()[2 * num_threads_ * NUM_PHASE_THREAD_STATS + stat] += count;
+    }
+
     /**
      * add load statistic
      */
     void addLoadStat(DrvAPI::DrvAPIPAddress addr, DrvThread *thread) {
-        int tid = getThreadID(thread);
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comp_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->load_l1sp->addData(1);
-                phase_stats->load_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->load_l2sp->addData(1);
-                phase_stats->load_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->load_dram->addData(1);
-                phase_stats->load_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr))  {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_LOAD, "read_req", addr, thread);
-                total_stats->load_remote_pxn->addData(1);
-                phase_stats->load_remote_pxn->addData(1);
-            }
+        if (!isStatStage()) {
+            return;
         }
-        else if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comm_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->load_l1sp->addData(1);
-                phase_stats->load_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->load_l2sp->addData(1);
-                phase_stats->load_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->load_dram->addData(1);
-                phase_stats->load_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr))  {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_LOAD, "read_req", addr, thread);
-                total_stats->load_remote_pxn->addData(1);
-                phase_stats->load_remote_pxn->addData(1);
-            }
+        int tid = getThreadID(thread);
+        ThreadStat *total_stats = &total_thread_stats_[tid];
+        if (isPAddressL1SP(addr)) {
+            total_stats->load_l1sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_LOAD_L1SP);
+        } else if (isPAddressL2SP(addr)) {
+            total_stats->load_l2sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_LOAD_L2SP);
+        } else if (isPAddressDRAM(addr)) {
+            total_stats->load_dram->addData(1);
+            addPhaseThreadStat(tid, PHASE_LOAD_DRAM);
+        } else if (isPAddressRemotePXN(addr))  {
+            traceRemotePxnMem(TRACE_REMOTE_PXN_LOAD, "read_req", addr, thread);
+            total_stats->load_remote_pxn->addData(1);
+            addPhaseThreadStat(tid, PHASE_LOAD_REMOTE_PXN);
         }
     }
 
@@ -474,42 +510,24 @@ public:
      * add store statistic
      */
     void addStoreStat(DrvAPI::DrvAPIPAddress addr, DrvThread *thread) {
-        int tid = getThreadID(thread);
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comp_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->store_l1sp->addData(1);
-                phase_stats->store_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->store_l2sp->addData(1);
-                phase_stats->store_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->store_dram->addData(1);
-                phase_stats->store_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr)) {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_STORE, "write_req", addr, thread);
-                total_stats->store_remote_pxn->addData(1);
-                phase_stats->store_remote_pxn->addData(1);
-            }
+        if (!isStatStage()) {
+            return;
         }
-        else if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comm_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->store_l1sp->addData(1);
-                phase_stats->store_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->store_l2sp->addData(1);
-                phase_stats->store_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->store_dram->addData(1);
-                phase_stats->store_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr)) {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_STORE, "write_req", addr, thread);
-                total_stats->store_remote_pxn->addData(1);
-                phase_stats->store_remote_pxn->addData(1);
-            }
+        int tid = getThreadID(thread);
+        ThreadStat *total_stats = &total_thread_stats_[tid];
+        if (isPAddressL1SP(addr)) {
+            total_stats->store_l1sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_STORE_L1SP);
+        } else if (isPAddressL2SP(addr)) {
+            total_stats->store_l2sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_STORE_L2SP);
+        } else if (isPAddressDRAM(addr)) {
+            total_stats->store_dram->addData(1);
+            addPhaseThreadStat(tid, PHASE_STORE_DRAM);
+        } else if (isPAddressRemotePXN(addr)) {
+            traceRemotePxnMem(TRACE_REMOTE_PXN_STORE, "write_req", addr, thread);
+            total_stats->store_remote_pxn->addData(1);
+            addPhaseThreadStat(tid, PHASE_STORE_REMOTE_PXN);
         }
     }
 
@@ -517,42 +535,24 @@ public:
      * add atomic statistic
      */
     void addAtomicStat(DrvAPI::DrvAPIPAddress addr, DrvThread *thread) {
-        int tid = getThreadID(thread);
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comp_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->atomic_l1sp->addData(1);
-                phase_stats->atomic_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->atomic_l2sp->addData(1);
-                phase_stats->atomic_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->atomic_dram->addData(1);
-                phase_stats->atomic_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr))  {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_ATOMIC, "atomic_req", addr, thread);
-                total_stats->atomic_remote_pxn->addData(1);
-                phase_stats->atomic_remote_pxn->addData(1);
-            }
+        if (!isStatStage()) {
+            return;
         }
-        else if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
-            ThreadStat *total_stats = &total_thread_stats_[tid];
-            ThreadStat *phase_stats = &(per_phase_comm_thread_stats_[phase_][tid]);
-            if (isPAddressL1SP(addr)) {
-                total_stats->atomic_l1sp->addData(1);
-                phase_stats->atomic_l1sp->addData(1);
-            } else if (isPAddressL2SP(addr)) {
-                total_stats->atomic_l2sp->addData(1);
-                phase_stats->atomic_l2sp->addData(1);
-            } else if (isPAddressDRAM(addr)) {
-                total_stats->atomic_dram->addData(1);
-                phase_stats->atomic_dram->addData(1);
-            } else if (isPAddressRemotePXN(addr))  {
-                traceRemotePxnMem(TRACE_REMOTE_PXN_ATOMIC, "atomic_req", addr, thread);
-                total_stats->atomic_remote_pxn->addData(1);
-                phase_stats->atomic_remote_pxn->addData(1);
-            }
+        int tid = getThreadID(thread);
+        ThreadStat *total_stats = &total_thread_stats_[tid];
+        if (isPAddressL1SP(addr)) {
+            total_stats->atomic_l1sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_ATOMIC_L1SP);
+        } else if (isPAddressL2SP(addr)) {
+            total_stats->atomic_l2sp->addData(1);
+            addPhaseThreadStat(tid, PHASE_ATOMIC_L2SP);
+        } else if (isPAddressDRAM(addr)) {
+            total_stats->atomic_dram->addData(1);
+            addPhaseThreadStat(tid, PHASE_ATOMIC_DRAM);
+        } else if (isPAddressRemotePXN(addr))  {
+            traceRemotePxnMem(TRACE_REMOTE_PXN_ATOMIC, "atomic_req", addr, thread);
+            total_stats->atomic_remote_pxn->addData(1);
+            addPhaseThreadStat(tid, PHASE_ATOMIC_REMOTE_PXN);
         }
     }
 
@@ -568,17 +568,22 @@ public:
         performGlobalStatisticOutput();
     }
 
+    /**
+     * write the non-zero counters of the active phases and reset them
+     */
+    void writePhaseStatistics();
+
     void addBusyCycleStat(uint64_t cycles) {
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP || stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
+        if (isStatStage()) {
             total_busy_cycles_->addData(cycles);
-            per_phase_busy_cycles_[phase_]->addData(cycles);
+            addPhaseCoreStat(PHASE_BUSY_CYCLES, cycles);
         }
     }
 
     void addStallCycleStat(uint64_t cycles) {
-        if (stage_ == DrvAPI::stage_t::STAGE_EXEC_COMP || stage_ == DrvAPI::stage_t::STAGE_EXEC_COMM) {
+        if (isStatStage()) {
             total_stall_cycles_->addData(cycles);
-            per_phase_stall_cycles_[phase_]->addData(cycles);
+            addPhaseCoreStat(PHASE_STALL_CYCLES, cycles);
         }
     }
 
@@ -602,6 +607,7 @@ private:
   DrvAPISetSysConfig_t set_sys_config_app_; //!< the set_sys_config function in the executable
   int done_; //!< number of threads that are done
   int last_thread_; //!< last thread that was executed
+  DrvReadyMask ready_threads_; //!< threads that can resume
   std::vector<char*> argv_; //!< the command line arguments
   SST::Link *loopback_; //!< the loopback link
   uint64_t max_idle_cycles_; //!< maximum number of idle cycles
@@ -616,13 +622,13 @@ private:
   // statistics
   DrvAPI::stage_t stage_; //!< the current stage
   std::vector<ThreadStat> total_thread_stats_; //!< the thread statistics
-  std::vector<std::vector<ThreadStat>> per_phase_comp_thread_stats_; //!< the thread statistics
-  std::vector<std::vector<ThreadStat>> per_phase_comm_thread_stats_; //!< the thread statistics
   int phase_; //!< the current phase
+  uint64_t phase_round_; //!< number of times the phase wrapped around phase_max_
   Statistic<uint64_t> *total_busy_cycles_; //!< busy cycles
   Statistic<uint64_t> *total_stall_cycles_; //!< stall cycles
-  std::vector<Statistic<uint64_t>*> per_phase_busy_cycles_; //!< busy cycles
-  std::vector<Statistic<uint64_t>*> per_phase_stall_cycles_; //!< stall cycles
+  bool phase_stats_on_; //!< true if per-phase statistics are collected
+  std::vector<std::vector<uint64_t>> phase_stats_; //!< per-phase counters; empty until the phase is active
+  std::string phase_stats_file_; //!< file for per-phase statistics
   int stat_dump_cnt_; //!< number of statistics dumps
 public:
   DrvMemory* memory_;  //!< the memory hierarchy
@@ -633,7 +639,7 @@ public:
   int pxn_; // !< pxn id of this core
   int num_threads_; //!< number of threads on this core
 
-  int phase_max_; //!< number of preallocated statistics
+  int phase_max_; //!< number of phases after which per-phase statistics are written
 };
 }
 }
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023 University of Washington
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Drv {
+
+/**
+ * A bitmask of the threads of a core that are ready to execute
+ *
+ * Selects the next ready thread in round-robin order with find-first-set
+ * instead of querying the state of every thread.
+ */
+class DrvReadyMask {
+public:
+    static constexpr int NONE = -1;
+
+    /**
+     * resize to @p size threads, none of which is ready
+     */
+    void resize(int size) {
+        size_ = size;
+        words_.assign((size + 63) / 64, 0);
+    }
+
+    /**
+     * set if thread @p i is ready
+     */
+    void set(int i, bool ready = true) {
+        uint64_t bit = uint64_t(1) << (i % 64);
+        if (ready) {
+            words_[i / 64] |= bit;
+        } else {
+            words_[i / 64] &= ~bit;
+        }
+    }
+
+    /**
+     * return true if thread @p i is ready
+     */
+    bool test(int i) const {
+        return (words_[i / 64] >> (i % 64)) & 1;
+    }
+
+    /**
+     * return true if any thread is ready
+     */
+    bool any() const {
+        for (uint64_t word : words_) {
+            if (word != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * return the first ready thread after @p last in round-robin order or NONE
+     */
+    int next(int last) const {
+        if (size_ == 0) {
+            return NONE;
+        }
+        int start = (last + 1) % size_;
+        int n = static_cast<int>(words_.size());
+        int w = start / 64;
+        // bits at and above start in its word, then the other words, then the bits below start
+        uint64_t word = words_[w] & (~uint64_t(0) << (start % 64));
+        for (int i = 0; i <= n; i++) {
+            if (word != 0) {
+                return w * 64 + __builtin_ctzll(word);
+            }
+            w = (w + 1) % n;
+            word = words_[w];
+            if (i == n - 1) {
+                word &= ~(~uint64_t(0) << (start % 64));
+            }
+        }
+        return NONE;
+    }
+
+    /**
+     * call @p f for each ready thread
+     */
+    template <typename F>
+    void forEach(F &&f) const {
+        for (int w = 0; w < static_cast<int>(words_.size()); w++) {
+            uint64_t word = words_[w];
+            while (word != 0) {
+                f(w * 64 + __builtin_ctzll(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    std::vector<uint64_t> words_;
+    int size_ = 0;
+};
+
+}
+}
@@ -33,26 +33,23 @@ void DrvSelfLinkMemory::handleEvent(SST::Event *ev) {
   std::shared_ptr<DrvAPI::DrvAPIMem> mem_req = mem_evt->req_;
 
   auto read = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemRead>(mem_req);
+  auto write = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemWrite>(mem_req);
+  auto atomic = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemAtomic>(mem_req);
   if (read) {
     read->setResult(&data_[read->getAddress()]);
     read->complete();
-    return;
-  }
-
-  auto write = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemWrite>(mem_req);
-  if (write) {
+  } else if (write) {
     write->getPayload(&data_[write->getAddress()]);
     write->complete();
-    return;
-  }
-
-  auto atomic = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemAtomic>(mem_req);
-  if (atomic) {
+  } else if (atomic) {
     atomic->setResult(&data_[atomic->getAddress()]);
     atomic->modify();
     atomic->getPayload(&data_[atomic->getAddress()]);
     atomic->complete();
-    return;
+  }
+  // the core may have turned its clock off while the thread waited
+  if (read || write || atomic) {
+    core_->markThreadReady(mem_evt->thread_);
   }
   core_->assertCoreOn();
   delete ev;
@@ -65,5 +62,6 @@ void DrvSelfLinkMemory::sendRequest(DrvCore *core
   core->output()->verbose(CALL_INFO, 2, DrvMemory::VERBOSE_REQ, "Sending request\n");
   auto ev = new DrvSelfLinkMemory::Event();
   ev->req_ = mem_req;
+  ev->thread_ = thread;
   link_->send(0, ev);
 }
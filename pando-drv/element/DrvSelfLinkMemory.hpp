@@ -70,6 +70,7 @@ public:
         virtual ~Event() {}
 
         std::shared_ptr<DrvAPI::DrvAPIMem> req_; //!< The memory request
+        DrvThread *thread_ = nullptr; //!< The thread that issued the request
 
         ImplementSerializable(SST::Drv::DrvSelfLinkMemory::Event);
     };
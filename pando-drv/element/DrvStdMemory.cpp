@@ -23,9 +23,9 @@ void DrvStdMemory::ToNativeMetaData::init(DrvStdMemory *mem) {
     }
     DrvCore *core = mem->core_;
     DrvAPI::DrvAPISysConfig cfg = core->sysConfig().config();
-    l1sp_mcs.resize(cfg.numPXN(), std::vector<std::vector<record_type>>(cfg.numPXNPods()));
-    l2sp_mcs.resize(cfg.numPXN(), std::vector<std::vector<record_type>>(cfg.numPXNPods()));
-    dram_mcs.resize(cfg.numPXN());
+    std::vector<std::vector<std::vector<record_type>>> l1sp_mcs(cfg.numPXN(), std::vector<std::vector<record_type>>(cfg.numPXNPods()));
+    std::vector<std::vector<std::vector<record_type>>> l2sp_mcs(cfg.numPXN(), std::vector<std::vector<record_type>>(cfg.numPXNPods()));
+    std::vector<std::vector<record_type>> dram_mcs(cfg.numPXN());
     for (record_type &record : SST::MemHierarchy::MemController::AddrRangeToMC) {
         DrvAPI::DrvAPIPAddress start, end;
         SST::MemHierarchy::MemController *mc;
@@ -41,35 +41,63 @@ void DrvStdMemory::ToNativeMetaData::init(DrvStdMemory *mem) {
             dram_mcs[pxn].push_back(record);
         }
     }
-    // sort the records by start address
+
+    // make a region of the records, with one bank per record in order of start address
+    auto addRegion = [&](std::vector<record_type> &records, uint32_t type, uint64_t interleave) {
+        std::sort(records.begin(), records.end(), [](const record_type &a, const record_type &b) {
+            return std::get<0>(a) < std::get<0>(b);
+        });
+        Region region;
+        region.start = std::get<0>(records.front());
+        region.end = std::get<1>(records.front());
+        region.type = type;
+        region.interleave = interleave;
+        if (interleave != 0) {
+            region.decoder = {interleave, static_cast<int64_t>(records.size())};
+        }
+        for (record_type &record : records) {
+            Bank bank;
+            bank.mc = std::get<2>(record);
+            auto *backing = dynamic_cast<SST::MemHierarchy::Backend::BackingMMAP*>
+                (bank.mc->backing_);
+            if (backing) {
+                bank.buffer = backing->m_buffer;
+                bank.size = backing->m_size;
+            }
+            region.banks.push_back(bank);
+            region.end = std::max<uint64_t>(region.end, std::get<1>(record));
+        }
+        regions.push_back(std::move(region));
+    };
+
     for (int pxn = 0; pxn < cfg.numPXN(); pxn++) {
         for (int pod = 0; pod < cfg.numPXNPods(); pod++) {
             // check that we found one per core in pod
             if (l1sp_mcs[pxn][pod].size() != (size_t)cfg.numPodCores()) {
                 mem->output_.fatal(CALL_INFO, -1, "Did not find correct number of L1SP banks for pod %d\n", pod);
             }
-            std::sort(l1sp_mcs[pxn][pod].begin(), l1sp_mcs[pxn][pod].end(), [](const record_type &a, const record_type &b) {
-                return std::get<0>(a) < std::get<0>(b);
-            });
+            // every core has its own region
+            for (record_type &record : l1sp_mcs[pxn][pod]) {
+                std::vector<record_type> records = {record};
+                addRegion(records, DrvAPI::DrvAPIPAddress::TYPE_L1SP, 0);
+            }
             // check that we found correct number of banks for pod
             if (l2sp_mcs[pxn][pod].size() != (size_t)cfg.podL2SPBankCount()) {
                 mem->output_.fatal(CALL_INFO, -1, "Did not find correct number of L2SP banks for pod %d\n", pod);
             }
-            std::sort(l2sp_mcs[pxn][pod].begin(), l2sp_mcs[pxn][pod].end(), [](const record_type &a, const record_type &b) {
-                return std::get<0>(a) < std::get<0>(b);
-            });
+            addRegion(l2sp_mcs[pxn][pod], DrvAPI::DrvAPIPAddress::TYPE_L2SP, cfg.podL2SPInterleaveSize());
         }
         // check that we found correct number of dram banks for pxn
         if (dram_mcs[pxn].size() != (size_t)cfg.pxnDRAMPortCount()) {
             mem->output_.fatal(CALL_INFO, -1, "Did not find correct number of DRAM banks for pxn %d\n", pxn);
         }
-        std::sort(dram_mcs[pxn].begin(), dram_mcs[pxn].end(), [](const record_type &a, const record_type &b) {
-            return std::get<0>(a) < std::get<0>(b);
-        });
+        addRegion(dram_mcs[pxn], DrvAPI::DrvAPIPAddress::TYPE_DRAM, cfg.pxnDRAMInterleaveSize());
     }
 
-    l2sp_interleave_decode = {cfg.podL2SPInterleaveSize(), cfg.podL2SPBankCount()};
-    dram_interleave_decode = {cfg.pxnDRAMInterleaveSize(), cfg.pxnDRAMPortCount()};
+    // sort the regions by start address
+    std::sort(regions.begin(), regions.end(), [](const Region &a, const Region &b) {
+        return a.start < b.start;
+    });
 }
 
 /**
@@ -131,112 +159,28 @@ void DrvStdMemory::setup() {
  * @brief translate a pgas pointer to a native pointer
  */
 void
-DrvStdMemory::toNativePointerDRAM(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size) {
-    DrvAPI::DrvAPISysConfig cfg = core_->sysConfig().config();
-    uint32_t interleave = cfg.pxnDRAMInterleaveSize();
-    DrvAPI::DrvAPIPAddress decode(addr);
-    int pxn = decode.pxn();
-    std::vector<record_type> &dram_mcs = to_native_meta_data_.dram_mcs[pxn];
-    uint64_t dram_offset = decode.dram_offset();
-    uint64_t bank, offset;
-    std::tie(bank, offset)
-        = to_native_meta_data_
-        .dram_interleave_decode
-        .getBankOffset(dram_offset);
-
-    DrvAPI::DrvAPIPAddress start, stop;
-    SST::MemHierarchy::MemController *mc;
-    std::tie(start, stop, mc) = dram_mcs[bank];
-    uint64_t laddr = mc->translateToLocal(addr);
-    auto *backing = dynamic_cast<SST::MemHierarchy::Backend::BackingMMAP*>
-        (mc->backing_);
-    if (!backing) {
-        output_.fatal(CALL_INFO, -1, "MainMemory backing is not a MMAP\n");
-    }
-    uint8_t *bptr = &backing->m_buffer[laddr];
-    *ptr = bptr;
-    *size = interleave - offset;
-}
-
-/**
- * @brief translate a pgas pointer to a native pointer
- */
-void
-DrvStdMemory::toNativePointerL2SP(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size) {
-    DrvAPI::DrvAPISysConfig cfg = core_->sysConfig().config();
-    uint32_t interleave = cfg.podL2SPInterleaveSize();
-    DrvAPI::DrvAPIPAddress decode(addr);
-    int pxn = decode.pxn();
-    int pod = decode.pod();
-    std::vector<record_type> &l2sp_mcs = to_native_meta_data_.l2sp_mcs[pxn][pod];
-
-    uint64_t l2_offset = decode.l2_offset();
-    uint64_t bank, offset;
-    std::tie(bank, offset)
-        = to_native_meta_data_
-        .l2sp_interleave_decode
-        .getBankOffset(l2_offset);
-
-
-    DrvAPI::DrvAPIPAddress start, stop;
-    SST::MemHierarchy::MemController *mc;
-    std::tie(start, stop, mc) = l2sp_mcs[bank];
-    uint64_t laddr = mc->translateToLocal(addr);
-    auto *backing = dynamic_cast<SST::MemHierarchy::Backend::BackingMMAP*>
-        (mc->backing_);
-    if (!backing) {
-        output_.fatal(CALL_INFO, -1, "L2SP backing is not a MMAP\n");
-    }
-    uint8_t *bptr = &backing->m_buffer[laddr];
-    *ptr = bptr;
-    *size = interleave - offset;
-}
-
-/**
- * @brief translate a pgas pointer to a native pointer
- */
-void
-DrvStdMemory::toNativePointerL1SP(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size) {
-    DrvAPI::DrvAPIPAddress decode(addr);
-    int pxn = decode.pxn();
-    int pod = decode.pod();
-    int core = DrvAPI::coreIdFromXY(decode.core_x(), decode.core_y());
-    // todo: we might not need a for loop here
-    DrvAPI::DrvAPIAddress start, end;
-    SST::MemHierarchy::MemController *mc;
-    std::tie(start, end, mc) = to_native_meta_data_.l1sp_mcs[pxn][pod][core];
-    if (start <= addr && addr < end) {
-        uint64_t laddr = mc->translateToLocal(addr);
-        auto *backing = dynamic_cast<SST::MemHierarchy::Backend::BackingMMAP*>
-            (mc->backing_);
-        if (!backing) {
-            output_.fatal(CALL_INFO, -1, "Backing is not MMAP\n");
-        }
-        uint8_t *bptr = &backing->m_buffer[laddr];
-        *ptr = bptr;
-        *size = backing->m_size - laddr;
-        return;
+DrvStdMemory::toNativePointer(DrvAPI::DrvAPIAddress paddr, void **ptr, size_t *size) {
+    const ToNativeMetaData::Region *region = to_native_meta_data_.findRegion(paddr);
+    if (!region) {
+        output_.fatal(CALL_INFO, -1, "Address 0x%lx not found in L1SP, L2SP or DRAM\n", paddr);
     }
-    output_.fatal(CALL_INFO, -1, "Address 0x%lx not found in L1SP\n", addr);
-}
 
-/**
- * @brief translate a pgas pointer to a native pointer
- */
-void
-DrvStdMemory::toNativePointer(DrvAPI::DrvAPIAddress paddr, void **ptr, size_t *size) {
+    // find the bank and the bytes left in its interleave block
     DrvAPI::DrvAPIPAddress decode{paddr};
-    if (decode.type() == DrvAPI::DrvAPIPAddress::TYPE_DRAM) {
-        return toNativePointerDRAM(paddr, ptr, size);
-    } else if (decode.type() == DrvAPI::DrvAPIPAddress::TYPE_L2SP) {
-        return toNativePointerL2SP(paddr, ptr, size);
-    } else if (decode.type() == DrvAPI::DrvAPIPAddress::TYPE_L1SP) {
-        return toNativePointerL1SP(paddr, ptr, size);
-    } else {
-        output_.fatal(CALL_INFO, -1, "Unknown address type\n");
+    uint64_t bank = 0, offset = 0;
+    if (region->type == DrvAPI::DrvAPIPAddress::TYPE_DRAM) {
+        std::tie(bank, offset) = region->decoder.getBankOffset(decode.dram_offset());
+    } else if (region->type == DrvAPI::DrvAPIPAddress::TYPE_L2SP) {
+        std::tie(bank, offset) = region->decoder.getBankOffset(decode.l2_offset());
     }
-    return;
 
+    const ToNativeMetaData::Bank &b = region->banks[bank];
+    if (!b.buffer) {
+        output_.fatal(CALL_INFO, -1, "Backing of address 0x%lx is not a MMAP\n", paddr);
+    }
+    uint64_t laddr = b.mc->translateToLocal(paddr);
+    *ptr = &b.buffer[laddr];
+    *size = region->interleave != 0 ? region->interleave - offset : b.size - laddr;
 }
 
 
@@ -382,6 +326,7 @@ DrvStdMemory::handleEvent(SST::Interfaces::StandardMem::Request *req) {
         mem_req = std::dynamic_pointer_cast<DrvAPI::DrvAPIMem>(thread->getAPIThread().getState());
         if (mem_req) {
             mem_req->complete();
+            core_->markThreadReady(thread);
         } else {
             output_.fatal(CALL_INFO, -1, "Failed to find memory request for tid=%" PRIu32 "\n", write_rsp->tid);
         }
@@ -406,6 +351,7 @@ DrvStdMemory::handleEvent(SST::Interfaces::StandardMem::Request *req) {
         if (read_req) {
             read_req->setResult(&read_rsp->data[0]);
             read_req->complete();
+            core_->markThreadReady(thread);
         }
 
         if (!read_req) {
@@ -428,6 +374,7 @@ DrvStdMemory::handleEvent(SST::Interfaces::StandardMem::Request *req) {
             if (atomic_req) {
                 atomic_req->setResult(&atomic_data->rdata[0]);
                 atomic_req->complete();
+                core_->markThreadReady(thread);
             } else {
                 output_.fatal(CALL_INFO, -1, "Failed to find memory request for tid=%" PRIu32 "\n", custom_rsp->tid);
             }
@@ -445,6 +392,7 @@ DrvStdMemory::handleEvent(SST::Interfaces::StandardMem::Request *req) {
             auto monitor_req = std::dynamic_pointer_cast<DrvAPI::DrvAPIMemMonitor>(thread->getAPIThread().getState());
             if (monitor_req) {
                 monitor_req->complete();
+                core_->markThreadReady(thread);
             } else {
                 output_.fatal(CALL_INFO, -1, "Failed to find memory request for tid=%" PRIu32 "\n", custom_rsp->tid);
             }
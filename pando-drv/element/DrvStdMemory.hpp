@@ -9,6 +9,7 @@
 #include <sst/core/interfaces/stdMem.h>
 #include <sst/core/event.h>
 #include <sst/elements/memHierarchy/memoryController.h>
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 namespace SST {
@@ -55,6 +56,25 @@ public:
                 return std::make_tuple(bank, offset);
             }
         };
+        /**
+         * a mem controller and the native buffer that backs it
+         */
+        struct Bank {
+            SST::MemHierarchy::MemController *mc = nullptr;
+            uint8_t *buffer = nullptr; //!< null if the backing is not a MMAP
+            uint64_t size = 0;
+        };
+        /**
+         * a contiguous physical address range and the banks it is interleaved over
+         */
+        struct Region {
+            uint64_t start = 0;
+            uint64_t end = 0;
+            uint32_t type = 0;
+            uint64_t interleave = 0;
+            InterleaveDecoder decoder;
+            std::vector<Bank> banks;
+        };
         ToNativeMetaData() = default;
         ToNativeMetaData(const ToNativeMetaData&) = delete;
         ToNativeMetaData& operator=(const ToNativeMetaData&) = delete;
@@ -67,11 +87,21 @@ public:
          */
         void init(DrvStdMemory *mem);
 
-        std::vector<std::vector<std::vector<record_type>>> l1sp_mcs; //!< l1sps mem controllers and their address ranges
-        std::vector<std::vector<std::vector<record_type>>> l2sp_mcs; //!< l2sps mem controllers and their address ranges
-        std::vector<std::vector<record_type>> dram_mcs; //!< drams mem controllers and their address ranges
-        InterleaveDecoder l2sp_interleave_decode;
-        InterleaveDecoder dram_interleave_decode;
+        /**
+         * find the region that holds an address, or nullptr
+         */
+        const Region *findRegion(uint64_t addr) const {
+            auto it = std::upper_bound(regions.begin(), regions.end(), addr, [](uint64_t a, const Region &r) {
+                return a < r.start;
+            });
+            if (it == regions.begin()) {
+                return nullptr;
+            }
+            --it;
+            return addr < it->end ? &*it : nullptr;
+        }
+
+        std::vector<Region> regions; //!< l1sp, l2sp and dram regions sorted by start address
         std::atomic<bool> initialized = false;
     };
 
@@ -135,6 +165,9 @@ public:
 
     /**
      * @brief translate a pgas pointer to a native pointer
+     *
+     * size is set to the number of bytes from ptr that are contiguous in
+     * native memory, so a transfer needs one translation per interleave block
      */
     void toNativePointer(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size);
 
@@ -146,21 +179,6 @@ private:
      */
     void handleEvent(SST::Interfaces::StandardMem::Request *req);
 
-    /**
-     * @brief translate a pgas pointer to a native pointer
-     */
-    void toNativePointerDRAM(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size);
-
-    /**
-     * @brief translate a pgas pointer to a native pointer
-     */
-    void toNativePointerL2SP(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size);
-
-    /**
-     * @brief translate a pgas pointer to a native pointer
-     */
-    void toNativePointerL1SP(DrvAPI::DrvAPIAddress addr, void **ptr, size_t *size);
-
     Interfaces::StandardMem *mem_; //!< The memory
 
     static ToNativeMetaData to_native_meta_data_; //!< holds data to help with toNative function
@@ -10,7 +10,10 @@ namespace Drv {
 
 void RISCVCore::configureClock(Params &params) {
     std::string clock = params.find<std::string>("clock", "1GHz");
-    clocktc_ = registerClock(clock, new Clock::Handler<RISCVCore>(this, &RISCVCore::tick));
+    clock_handler_ = new Clock::Handler<RISCVCore>(this, &RISCVCore::tick);
+    clocktc_ = registerClock(clock, clock_handler_);
+    core_on_ = true;
+    unregister_cycle_ = 0;
 }
 
 void RISCVCore::configureOuptut(Params& params) {
@@ -46,6 +49,8 @@ void RISCVCore::configureHarts(Params &params) {
     for (size_t i = 0; i < num_harts; i++) {
         harts_.push_back(RISCVSimHart{});
     }
+    ready_harts_.resize(num_harts);
+    cursors_.resize(num_harts);
     std::vector<KeyValue<int, uint64_t>> sps;
     params.find_array<KeyValue<int, uint64_t>>("sp", sps);
     output_.verbose(CALL_INFO, 1, 0, "Configuring sp for %lu harts\n", sps.size());
@@ -61,6 +66,7 @@ void RISCVCore::configureICache(Params &params) {
         output_.fatal(CALL_INFO, -1, "No program specified\n");
     }
     icache_ = new ICacheBacking(program.c_str());
+    block_cache_.reset(new RISCVBasicBlockCache<RISCVSimulator>(*icache_, decoder_));
     load_program_ = params.find<bool>("load", false);
 }
 
@@ -218,6 +224,7 @@ void RISCVCore::init(unsigned int phase) {
         hart.resetPC() = icache_->getStartAddr();
         hart.reset() = true;
     }
+    updateAllHartsReady();
     auto stdmem = dynamic_cast<Interfaces::StandardMem*>(mem_);
     if (stdmem) {
         stdmem->init(phase);
@@ -273,6 +280,7 @@ void RISCVCore::handleResetWrite(uint64_t v) {
             hart.reset() = true;
         }
     }
+    updateAllHartsReady();
 }
 
 /* handle mmio write request */
@@ -335,23 +343,21 @@ void RISCVCore::handleMemEvent(RISCVCore::Request *req) {
             output_.fatal(CALL_INFO, -1, "Received memory response for unknown hart\n");
         }
         it->second(req);
+        updateHartReady(tid);
     } else if (!write_req) {
         output_.fatal(CALL_INFO, -1, "Unknown memory request type\n");
     }
+    assertCoreOn();
 }
 
 /* select the next hart to execute */
 int RISCVCore::selectNextHart() {
-    int start = last_hart_ + 1;
-    int stop = start + harts_.size();
-    for (int h = start; h < stop; h++) {
-        int hart_id = h % harts_.size();
-        if (harts_[hart_id].ready()) {
-            last_hart_ = hart_id;
-            return hart_id;
-        }
+    int hart_id = ready_harts_.next(last_hart_);
+    if (hart_id == DrvReadyMask::NONE) {
+        return NO_HART;
     }
-    return NO_HART;
+    last_hart_ = hart_id;
+    return hart_id;
 }
 
 /* tick */
@@ -360,35 +366,44 @@ bool RISCVCore::tick(Cycle_t cycle) {
     if (hart_id != NO_HART) {
         addBusyCycleStat(1);
         uint64_t pc = harts_[hart_id].pc();
-        uint32_t inst = icache_->read(pc);
-        RISCVInstruction *i = nullptr;
+        const RISCVBasicBlockCache<RISCVSimulator>::Entry *entry = nullptr;
         try {
-            i = decoder_.decode(inst);
+            entry = &block_cache_->fetch(pc, cursors_[hart_id]);
         } catch (std::runtime_error &e) {
             std::stringstream ss;
             ss << "Failed to decode instruction at pc = 0x" << std::hex << pc << ": " << e.what();
             throw std::runtime_error(ss.str());
         }
+        RISCVInstruction &i = *entry->instruction;
         output_.verbose(CALL_INFO, 100, 0, "Ticking hart %2d: pc = 0x%016" PRIx64 ", instr = 0x%08" PRIx32" (%s)\n"
                         ,hart_id
                         ,pc
-                        ,inst
-                        ,i->getMnemonic()
+                        ,entry->encoding
+                        ,i.getMnemonic()
                         );
-        profileInstruction(harts_[hart_id], *i);
+        profileInstruction(harts_[hart_id], i);
         auto &stats = thread_stats_[hart_id];
-        stats.instruction_count[i->getInstructionId()]->addData(1);
-        sim_->visit(harts_[hart_id], *i);
-        delete i;
+        stats.instruction_count[i.getInstructionId()]->addData(1);
+        entry->execute(*sim_, harts_[hart_id]);
+        updateHartReady(hart_id);
     } else {
         addStallCycleStat(1);
         output_.verbose(CALL_INFO, 0, DEBUG_IDLE, "No harts ready to execute\n");
     }
 
-    if (shouldExit())
+    if (shouldExit()) {
         primaryComponentOKToEndSim();
+        return true;
+    }
 
-    return shouldExit();
+    // only a memory response or a reset write can make a hart ready
+    if (!ready_harts_.any()) {
+        output_.verbose(CALL_INFO, 0, DEBUG_IDLE, "Turning core off\n");
+        core_on_ = false;
+        unregister_cycle_ = getCurrentSimTime(clocktc_);
+        return true;
+    }
+    return false;
 }
 
 /**
@@ -411,6 +426,8 @@ void RISCVCore::handleLoopback(Event *evt) {
         for (auto &hart : harts_) {
             hart.reset() = false;
         }
+        updateAllHartsReady();
+        assertCoreOn();
     }
     delete evt;
 }
@@ -12,12 +12,14 @@
 #include <RISCVDecoder.hpp>
 #include <RISCVInterpreter.hpp>
 #include <ICacheBacking.hpp>
+#include <RISCVBasicBlockCache.hpp>
 #include "SSTRISCVSimulator.hpp"
 #include "SSTRISCVHart.hpp"
 #include "DrvSysConfig.hpp"
 #include "DrvAPIAddress.hpp"
 #include "DrvAPIAddressMap.hpp"
 #include "DrvStats.hpp"
+#include "DrvReadyMask.hpp"
 namespace SST {
 namespace Drv {
 
@@ -298,6 +300,34 @@ public:
      */
     int selectNextHart();
 
+    /**
+     * update the ready mask entry of a hart
+     */
+    void updateHartReady(int hart_id) {
+        ready_harts_.set(hart_id, harts_[hart_id].ready());
+    }
+
+    /**
+     * update the ready mask entries of all harts
+     */
+    void updateAllHartsReady() {
+        for (size_t hart_id = 0; hart_id < harts_.size(); hart_id++) {
+            updateHartReady(hart_id);
+        }
+    }
+
+    /**
+     * turn the clock back on if a hart is ready
+     */
+    void assertCoreOn() {
+        if (!core_on_ && ready_harts_.any()) {
+            core_on_ = true;
+            output_.verbose(CALL_INFO, 0, DEBUG_IDLE, "Turning core on\n");
+            addStallCycleStat(getCurrentSimTime(clocktc_) - unregister_cycle_);
+            reregisterClock(clocktc_, clock_handler_);
+        }
+    }
+
     /**
      * issue a memory request
      */
@@ -447,10 +477,16 @@ public:
     RISCVSimulator *sim_; //!< simulator
     ICacheBacking *icache_; //!< icache
     RISCVDecoder decoder_; //!< decoder
+    std::unique_ptr<RISCVBasicBlockCache<RISCVSimulator>> block_cache_; //!< decoded basic blocks
+    std::vector<RISCVBasicBlockCache<RISCVSimulator>::Cursor> cursors_; //!< position of each hart in its block
     std::vector<RISCVSimHart> harts_; //!< harts
     std::map<int, ICompletionHandler> rsp_handlers_; //!< response handlers
     SST::TimeConverter *clocktc_; //!< the clock time converter
+    Clock::Handler<RISCVCore> *clock_handler_; //!< the clock handler
+    bool core_on_; //!< true if the clock handler is registered
+    SimTime_t unregister_cycle_; //!< cycle when the clock handler was last unregistered
     int last_hart_; //!< last hart to execute
+    DrvReadyMask ready_harts_; //!< harts that can execute
     bool load_program_; //!< load program
     DrvSysConfig sys_config_; //!< system configuration
     std::map<uint64_t, int64_t> pchist_; //!< program counter history
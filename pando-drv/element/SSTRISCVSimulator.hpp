@@ -63,6 +63,11 @@ private:
     template <typename T>
     void visitAMO(RISCVHart &hart, RISCVInstruction &i, DrvAPI::DrvAPIMemAtomicType op);
 
+    template <typename T>
+    void visitAMOCAS(RISCVHart &hart, RISCVInstruction &i);
+
+public:
+    // called directly by RISCVBasicBlockCache
     void visitAMOSWAPW(RISCVHart &hart, RISCVInstruction &instruction) override;
     void visitAMOSWAPW_RL(RISCVHart &hart, RISCVInstruction &instruction) override;
     void visitAMOSWAPW_AQ(RISCVHart &hart, RISCVInstruction &instruction) override;
@@ -83,9 +88,6 @@ private:
     void visitAMOADDD_AQ(RISCVHart &hart, RISCVInstruction &instruction) override;
     void visitAMOADDD_RL_AQ(RISCVHart &hart, RISCVInstruction &instruction) override;
 
-    template <typename T>
-    void visitAMOCAS(RISCVHart &hart, RISCVInstruction &i);
-
     void visitAMOCASW(RISCVHart &hart, RISCVInstruction &instruction) override;
     void visitAMOCASW_RL(RISCVHart &hart, RISCVInstruction &instruction) override;
     void visitAMOCASW_AQ(RISCVHart &hart, RISCVInstruction &instruction) override;
@@ -99,6 +101,7 @@ private:
     // environment calls
     void visitECALL(RISCVHart &hart, RISCVInstruction &instruction) override;
 
+private:
     RISCVCore *core_; //!< the riscv core component
     static constexpr uint64_t MMIO_SIZE       = 0xFFFF;
     static constexpr uint64_t MMIO_BASE       = 0xFFFFFFFFFFFF0000;
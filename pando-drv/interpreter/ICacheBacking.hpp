@@ -123,6 +123,10 @@ public:
         return nullptr;
     }
 
+    bool contains(Elf64_Addr addr) {
+        return findTextPhdr(addr) != nullptr;
+    }
+
     uint32_t read(Elf64_Addr addr) {
         auto ph = findTextPhdr(addr);
         if (ph == nullptr) {
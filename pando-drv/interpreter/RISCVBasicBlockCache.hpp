@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023 University of Washington
+
+#ifndef RISCVBASICBLOCKCACHE_HPP
+#define RISCVBASICBLOCKCACHE_HPP
+#include "RISCVInstruction.hpp"
+#include "RISCVDecoder.hpp"
+#include "ICacheBacking.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief A cache of decoded basic blocks with direct-threaded handlers.
+ *
+ * A block is a straight-line run of instructions translated on first use. It
+ * ends after a control transfer or after an instruction that accesses memory
+ * or the system, since those need the simulator's timing. Each instruction is
+ * paired with a handler that calls the visitor of @p Interpreter without
+ * virtual dispatch, so executing a cached instruction costs neither decoding
+ * nor a heap allocation.
+ *
+ * Instructions are read from the program's text segments, which are
+ * read-only, so blocks are never invalidated.
+ */
+template <typename Interpreter>
+class RISCVBasicBlockCache {
+public:
+    using Handler = void (*)(Interpreter &, RISCVHart &, RISCVInstruction &);
+
+    /**
+     * @brief a decoded instruction and its handler
+     */
+    struct Entry {
+        Handler handler;
+        std::unique_ptr<RISCVInstruction> instruction;
+        uint32_t encoding;
+
+        void execute(Interpreter &interpreter, RISCVHart &hart) const {
+            handler(interpreter, hart, *instruction);
+        }
+    };
+
+    /**
+     * @brief a translated basic block
+     */
+    struct Block {
+        uint64_t pc;
+        std::vector<Entry> entries;
+    };
+
+    /**
+     * @brief the position of a hart in its current block
+     */
+    struct Cursor {
+        const Block *block = nullptr;
+        size_t index = 0;
+    };
+
+    static constexpr size_t MAX_BLOCK_SIZE = 64;
+
+    RISCVBasicBlockCache(ICacheBacking &icache, RISCVDecoder &decoder)
+        : icache_(icache)
+        , decoder_(decoder) {}
+
+    /**
+     * @brief return the instruction at @p pc and advance @p cursor past it
+     *
+     * Sequential instructions of a block are found through the cursor without
+     * a lookup.
+     */
+    const Entry &fetch(uint64_t pc, Cursor &cursor) {
+        if (cursor.block == nullptr
+            || cursor.index >= cursor.block->entries.size()
+            || cursor.block->pc + 4 * cursor.index != pc) {
+            cursor.block = &lookup(pc);
+            cursor.index = 0;
+        }
+        return cursor.block->entries[cursor.index++];
+    }
+
+    /**
+     * @brief return the block that starts at @p pc, translating it on a miss
+     */
+    const Block &lookup(uint64_t pc) {
+        auto it = blocks_.find(pc);
+        if (it != blocks_.end()) {
+            return *it->second;
+        }
+        std::unique_ptr<Block> block = translate(pc);
+        const Block &ref = *block;
+        blocks_.emplace(pc, std::move(block));
+        return ref;
+    }
+
+    /**
+     * @brief return the number of translated blocks
+     */
+    size_t size() const { return blocks_.size(); }
+
+    /**
+     * @brief return true if the instruction ends a basic block
+     */
+    static bool endsBlock(uint32_t instruction) {
+        switch (instruction & 0x7F) {
+        case 0x03: // LOAD
+        case 0x07: // LOAD-FP
+        case 0x0F: // MISC-MEM
+        case 0x23: // STORE
+        case 0x27: // STORE-FP
+        case 0x2F: // AMO
+        case 0x63: // BRANCH
+        case 0x67: // JALR
+        case 0x6F: // JAL
+        case 0x73: // SYSTEM
+            return true;
+        default:
+            return false;
+        }
+    }
+
+private:
+#define DEFINSTR(mnemonic, ...)                                         \
+    static void execute ## mnemonic(Interpreter &interpreter, RISCVHart &hart, RISCVInstruction &instruction) { \
+        interpreter.Interpreter::visit ## mnemonic(hart, instruction);  \
+    }
+#include "InstructionTable.h"
+#undef DEFINSTR
+
+    static Handler handler(RISCVInstructionId id) {
+        static const Handler handlers[NumInstructionIds] = {
+#define DEFINSTR(mnemonic, ...) &RISCVBasicBlockCache::execute ## mnemonic,
+#include "InstructionTable.h"
+#undef DEFINSTR
+        };
+        return handlers[id];
+    }
+
+    std::unique_ptr<Block> translate(uint64_t pc) {
+        std::unique_ptr<Block> block(new Block);
+        block->pc = pc;
+        for (uint64_t ipc = pc; block->entries.size() < MAX_BLOCK_SIZE; ipc += 4) {
+            if (ipc != pc && !icache_.contains(ipc)) {
+                break;
+            }
+            uint32_t instruction = icache_.read(ipc);
+            std::unique_ptr<RISCVInstruction> decoded;
+            try {
+                decoded.reset(decoder_.decode(instruction));
+            } catch (std::runtime_error &) {
+                // the instruction may never execute; fail when it does
+                if (ipc == pc) {
+                    throw;
+                }
+                break;
+            }
+            RISCVInstructionId id = decoded->getInstructionId();
+            block->entries.push_back(Entry{handler(id), std::move(decoded), instruction});
+            if (endsBlock(instruction)) {
+                break;
+            }
+        }
+        return block;
+    }
+
+    ICacheBacking &icache_;
+    RISCVDecoder &decoder_;
+    std::unordered_map<uint64_t, std::unique_ptr<Block>> blocks_;
+};
+
+#endif
@@ -31,11 +31,7 @@ if (arguments.perf_stats):
         "Drv.DrvCore",
         ["total_stall_cycles_when_ready",
         "total_stall_cycles",
-        "total_busy_cycles",
-        "phase_comp_stall_cycles_when_ready",
-        "phase_comm_stall_cycles_when_ready",
-        "phase_stall_cycles",
-        "phase_busy_cycles"])
+        "total_busy_cycles"])
     sst.enableStatisticsForComponentType(
         "memHierarchy.MemNIC",
         ["send_bit_count",
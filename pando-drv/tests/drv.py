@@ -121,7 +121,8 @@ parser.add_argument("--core-stats", action="store_true", help="enable core stati
 parser.add_argument("--all-stats", action="store_true", help="enable all statistics")
 parser.add_argument("--perf-stats", action="store_true", help="enable performance statistics")
 parser.add_argument("--stats-load-level", type=int, default=0, help="load level for statistics")
-parser.add_argument("--stats-preallocated-phase", type=int, default=16, help="preallocated number of phases for statistics")
+parser.add_argument("--stats-preallocated-phase", type=int, default=16, help="number of phases after which per-phase statistics are written")
+parser.add_argument("--phase-stats", action="store_true", help="write per-phase core statistics of active phases to phase_stats.csv")
 parser.add_argument("--trace-remote-pxn-memory", action="store_true", help="trace remote pxn memory accesses")
 
 arguments = parser.parse_args()
@@ -366,6 +367,7 @@ class CommandProcessor(object):
             "pod" : self.pod,
             "pxn" : self.pxn,
             "phase_max" : arguments.stats_preallocated_phase,
+            "phase_stats" : arguments.phase_stats,
         })
         self.core.addParams(SYSCONFIG)
         self.core.addParams(CORE_DEBUG)
@@ -164,6 +164,7 @@ class DrvXTile(Tile):
             "pod" : self.pod,
             "pxn" : self.pxn,
             "phase_max" : arguments.stats_preallocated_phase,
+            "phase_stats" : arguments.phase_stats,
             "stack_in_l1sp" : arguments.drvx_stack_in_l1sp,
             "clock" : arguments.core_clock,
         })
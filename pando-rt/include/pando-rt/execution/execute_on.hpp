@@ -29,7 +29,27 @@ namespace pando {
  */
 template <typename F, typename... Args>
 [[nodiscard]] Status executeOn(Place place, F&& f, Args&&... args) {
-  // TODO(ashwin #37): until there is load balancing, map anyNode / anyPod to the current node / pod
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+  if (place.node == anyNode) {
+    // keep the task serialized in the load balancing pool of this node, so that other nodes can
+    // steal it
+    using RequestType = detail::AsyncTaskRequest<F, Args...>;
+    const auto size = RequestType::size(place, f, args...);
+    detail::RequestBuffer buffer;
+    if (buffer.acquire(anyNode, size) == Status::Success) {
+      new (buffer.get()) RequestType(place, f, args...);
+      buffer.release();
+      return Status::Success;
+    }
+    // the task cannot be pooled, so it executes on this node
+  }
+#elif defined(PANDO_RT_USE_BACKEND_DRVX) && defined(PANDO_RT_DRVX_WORK_STEALING)
+  if (place.pod == anyPod && place.core == anyCore) {
+    // keep the task in a pool, so that idle pods (and nodes, for anyNode) can steal it
+    return detail::executeOnAnyPod(place, Task(std::forward<F>(f), std::forward<Args>(args)...));
+  }
+#endif // PANDO_RT_USE_BACKEND_PREP
+
   if (place.node == anyNode) {
     place.node = getCurrentNode();
   }
@@ -72,6 +92,13 @@ template <typename F, typename... Args>
  */
 template <typename F, typename... Args>
 [[nodiscard]] Status executeOn(PodIndex podIdx, F&& f, Args&&... args) {
+#if defined(PANDO_RT_USE_BACKEND_DRVX) && defined(PANDO_RT_DRVX_WORK_STEALING)
+  if (podIdx == anyPod) {
+    return detail::executeOnAnyPod(Place{getCurrentNode(), anyPod, anyCore},
+                                   Task(std::forward<F>(f), std::forward<Args>(args)...));
+  }
+#endif // PANDO_RT_USE_BACKEND_DRVX && PANDO_RT_DRVX_WORK_STEALING
+
   // TODO(ashwin #37): until there is load balancing, map anyNode / anyPod to the current node / pod
   if (podIdx == anyPod) {
     podIdx = (isOnCP() ? PodIndex{0, 0} : getCurrentPod());
@@ -30,6 +30,26 @@ namespace detail {
  */
 PANDO_RT_EXPORT [[nodiscard]] Status executeOn(Place place, Task task);
 
+#if defined(PANDO_RT_USE_BACKEND_DRVX)
+
+/**
+ * @brief Pools @p task, whose @p place has @ref anyPod and @ref anyCore, in the current pod, or in
+ *        the first pod of the node in @p place if it is another node.
+ *
+ * Idle cores of any pod of the node, or of any node if the node in @p place is @ref anyNode, may
+ * take the task from the pool.
+ *
+ * @param[in] place place to execute @p task on
+ * @param[in] task  task to execute
+ *
+ * @return @ref Status::Success upon success, otherwise an error code
+ *
+ * @ingroup ROOT
+ */
+PANDO_RT_EXPORT [[nodiscard]] Status executeOnAnyPod(Place place, Task task);
+
+#endif // PANDO_RT_USE_BACKEND_DRVX
+
 } // namespace detail
 
 } // namespace pando
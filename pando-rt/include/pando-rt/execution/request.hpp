@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "../index.hpp"
+#include "../locality.hpp"
 #include "../memory/global_ptr.hpp"
 #include "../serialization/archive.hpp"
 #include "../status.hpp"
@@ -45,6 +46,9 @@ public:
 
   /**
    * @brief Allocates @p size bytes for a request to node @p nodeIdx.
+   *
+   * If @p nodeIdx is @ref anyNode, the request is kept in the load balancing pool of this node
+   * and may execute on any node. Requests that are too large cannot be pooled.
    */
   [[nodiscard]] Status acquire(NodeIndex nodeIdx, std::size_t size);
 
@@ -121,6 +125,14 @@ class AsyncTaskRequest final : public Request {
     ar(place);
     std::apply(ar, t);
 
+    // pooled requests execute on the node that took them
+    if (place.node == anyNode) {
+      place.node = getCurrentNode();
+    }
+    if (place.pod == anyPod) {
+      place.pod = PodIndex{0, 0};
+    }
+
     auto task = std::make_from_tuple<Task>(std::move(t));
     self->~AsyncTaskRequest(); // destroy this object; no members should be accessed after this
 
@@ -27,20 +27,30 @@ class BumpMemoryResource {
 private:
   using MutexValueType = detail::InplaceMutex::MutexValueType;
 
-  GlobalPtr<std::byte> m_buffer; // The start of the buffer managed by the  memory resource. The
-                                 // pointer is an invariant and lives in registers.
+  GlobalPtr<std::byte> m_buffer{nullptr}; // The start of the buffer managed by the  memory
+                                          // resource. The pointer is an invariant and lives in
+                                          // registers.
 
-  GlobalPtr<std::size_t> m_curOffset; // The last unused offset in the buffer. The location of this
-                                      // pointer lives in a predefined location (first 8 bytes).
+  GlobalPtr<std::size_t> m_curOffset{nullptr}; // The last unused offset in the buffer. The
+                                               // location of this pointer lives in a predefined
+                                               // location (first 8 bytes).
 
-  GlobalPtr<MutexValueType> m_mutex; // The mutex is global state that must be accessible by all
-                                     // cores  and live in predefined place (the
-                                     // `sizeof(MutexValueType)` bytes  after the `m_curOffset`).
+  GlobalPtr<MutexValueType> m_mutex{nullptr}; // The mutex is global state that must be accessible
+                                              // by all cores  and live in predefined place (the
+                                              // `sizeof(MutexValueType)` bytes  after the
+                                              // `m_curOffset`).
 
-  std::size_t m_capacity; // The bytes capacity of the resource. The capacity is a constant number
-                          // that lives in registers.
+  std::size_t m_capacity{0}; // The bytes capacity of the resource. The capacity is a constant
+                             // number that lives in registers.
 
 public:
+  /**
+   * @brief Construct a Bump Memory Resource object that does not manage any buffer.
+   *
+   * @note All allocations from such a resource fail.
+   */
+  constexpr BumpMemoryResource() noexcept = default;
+
   /**
    * @brief Construct a new Bump Memory Resource object
    *
@@ -92,6 +102,9 @@ public:
    */
   [[nodiscard]] GlobalPtr<void> allocate(std::size_t bytes,
                                          std::size_t = alignof(std::max_align_t)) {
+    if (m_capacity == 0) {
+      return nullptr;
+    }
     detail::InplaceMutex::lock(m_mutex);
 
     auto allocOffset = *m_curOffset;
@@ -120,6 +133,38 @@ public:
     return;
   }
 
+  /**
+   * @brief Returns the number of bytes handed out so far, including alignment padding.
+   */
+  std::size_t getUsedBytes() const {
+    if (m_capacity == 0) {
+      return 0;
+    }
+    detail::InplaceMutex::lock(m_mutex);
+    const std::size_t usedBytes = *m_curOffset;
+    detail::InplaceMutex::unlock(m_mutex);
+    return usedBytes;
+  }
+
+  /**
+   * @brief Releases all the allocations made after @p usedBytes bytes had been handed out.
+   *
+   * @warning None of the released allocations may be in use. The resource does not track
+   *          allocations, so it cannot detect misuse.
+   *
+   * @param usedBytes A value previously returned by @ref getUsedBytes
+   */
+  void rewind(std::size_t usedBytes) {
+    if (m_capacity == 0) {
+      return;
+    }
+    detail::InplaceMutex::lock(m_mutex);
+    if (usedBytes < *m_curOffset) {
+      *m_curOffset = usedBytes;
+    }
+    detail::InplaceMutex::unlock(m_mutex);
+  }
+
   /**
    * @brief Equality comparison between two bump memory resources
    *
@@ -4,6 +4,7 @@
 #ifndef PANDO_RT_MEMORY_FREELIST_MEMORY_RESOURCE_HPP_
 #define PANDO_RT_MEMORY_FREELIST_MEMORY_RESOURCE_HPP_
 
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -21,6 +22,15 @@ namespace pando {
  * @note The free list memory resource does not own memory; it only manages freed memory blocks
  *       added to the list on deallocate calls.
  *
+ * Freed blocks are kept in segregated lists, one per power-of-two size class, each with its own
+ * mutex. A request is served by a best-fit search in its own size class or by the first block of
+ * any larger class.
+ *
+ * The resource can optionally front the lists with caches (e.g., one per hart) that are only
+ * allocated from and deallocated to by their owner. Caches hold blocks of @ref isCacheableSize
+ * sizes and exchange them with the shared lists in batches. Each cache has its own mutex, which is
+ * only contended when @ref flushCaches returns the cached blocks to the shared lists.
+ *
  * @ingroup ROOT
  */
 class FreeListMemoryResource {
@@ -30,15 +40,34 @@ class FreeListMemoryResource {
     std::uint64_t blockSize{0};
   };
 
-  GlobalPtr<FreeListNode> m_head; // A pointer to the head of linked list. This pointer is a
-                                  // sentinel that its next member points to the first available
-                                  // memory block.
+  struct CacheEntry {
+    GlobalPtr<FreeListNode> head{nullptr};
+    std::uint64_t count{0};
+  };
 
   using MutexValueType = detail::InplaceMutex::MutexValueType;
 
-  GlobalPtr<MutexValueType> m_mutex; // The mutex is global state that must be accessible by all
-                                     // cores and live in predefined place in the memory buffer
-                                     // managed by the resource.
+  static constexpr std::size_t numSizeClasses = 48;
+  static constexpr std::size_t minCachedSizeClass = 8;
+  static constexpr std::size_t maxCachedSizeClass = 16;
+  static constexpr std::size_t numCachedSizeClasses = maxCachedSizeClass - minCachedSizeClass + 1;
+  static constexpr std::size_t cachedSizeStepsLog2 = 2; // cached sizes per size class, as log2
+  static constexpr std::size_t numCachedSizes = numCachedSizeClasses << cachedSizeStepsLog2;
+  static constexpr std::uint64_t cacheBatchSize = 8;
+
+  GlobalPtr<FreeListNode> m_heads; // Pointers to the heads of the linked lists, one per size
+                                   // class. Each head is a sentinel that its next member points
+                                   // to the first available memory block of its class.
+
+  GlobalPtr<MutexValueType> m_mutexes; // The mutexes are global state that must be accessible by
+                                       // all cores and live in predefined place in the memory
+                                       // buffer managed by the resource, one per size class.
+
+  GlobalPtr<MutexValueType> m_cacheMutexes; // The mutexes of the caches, one per cache.
+
+  GlobalPtr<CacheEntry> m_caches; // The caches, `numCachedSizes` entries per cache.
+
+  std::size_t m_numCaches; // The number of caches.
 
 public:
   /**
@@ -46,34 +75,65 @@ public:
 
    * @param bufferStart Start of the buffer that the resource should use.
    * @param bufferSize The buffer size in bytes. The buffer size must be greater than
-   *                   the value returned by `computeMetadataSize`.
+   *                   the value returned by `computeMetadataSize(numCaches)`.
+   * @param numCaches The number of caches to create.
    */
-  FreeListMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize) {
-    // align start for storage of mutex
-    auto voidCurrentStart = static_cast<GlobalPtr<void>>(bufferStart);
-    auto alignedCurrentStart =
-        align(alignof(MutexValueType), sizeof(MutexValueType), voidCurrentStart, bufferSize);
-    if (alignedCurrentStart == nullptr) {
+  FreeListMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize,
+                         std::size_t numCaches = 0)
+      : m_numCaches(numCaches) {
+    // align start for storage of the sentinel free list nodes
+    auto currentStart = static_cast<GlobalPtr<void>>(bufferStart);
+    currentStart = align(alignof(FreeListNode), sizeof(FreeListNode) * numSizeClasses,
+                         currentStart, bufferSize);
+    if (currentStart == nullptr) {
       PANDO_ABORT("Insufficient space to store metadata");
     }
-    m_mutex = static_cast<GlobalPtr<MutexValueType>>(alignedCurrentStart);
-    bufferSize -= sizeof(MutexValueType);
-
-    // store sentinel free list node
-    if (bufferSize < sizeof(FreeListNode)) {
+    m_heads = globalPtrReinterpretCast<GlobalPtr<FreeListNode>>(currentStart);
+    bufferSize -= sizeof(FreeListNode) * numSizeClasses;
+
+    // align start for storage of mutexes
+    currentStart = static_cast<GlobalPtr<std::byte>>(currentStart) +
+                   sizeof(FreeListNode) * numSizeClasses;
+    currentStart = align(alignof(MutexValueType), sizeof(MutexValueType) * numSizeClasses,
+                         currentStart, bufferSize);
+    if (currentStart == nullptr) {
       PANDO_ABORT("Insufficient space to store metadata");
     }
-    GlobalPtr<void> currentStart =
-        static_cast<GlobalPtr<std::byte>>(alignedCurrentStart) + sizeof(MutexValueType);
-    currentStart = align(alignof(FreeListNode), sizeof(FreeListNode), currentStart, bufferSize);
+    m_mutexes = static_cast<GlobalPtr<MutexValueType>>(currentStart);
+    bufferSize -= sizeof(MutexValueType) * numSizeClasses;
+
+    // align start for storage of cache mutexes
+    currentStart = static_cast<GlobalPtr<std::byte>>(currentStart) +
+                   sizeof(MutexValueType) * numSizeClasses;
+    currentStart = align(alignof(MutexValueType), sizeof(MutexValueType) * numCaches,
+                         currentStart, bufferSize);
     if (currentStart == nullptr) {
       PANDO_ABORT("Insufficient space to store metadata");
     }
-    m_head = globalPtrReinterpretCast<GlobalPtr<FreeListNode>>(currentStart);
+    m_cacheMutexes = static_cast<GlobalPtr<MutexValueType>>(currentStart);
+    bufferSize -= sizeof(MutexValueType) * numCaches;
+
+    // align start for storage of caches
+    const auto cacheBytes = sizeof(CacheEntry) * numCachedSizes * numCaches;
+    currentStart = static_cast<GlobalPtr<std::byte>>(currentStart) +
+                   sizeof(MutexValueType) * numCaches;
+    currentStart = align(alignof(CacheEntry), cacheBytes, currentStart, bufferSize);
+    if (currentStart == nullptr) {
+      PANDO_ABORT("Insufficient space to store metadata");
+    }
+    m_caches = globalPtrReinterpretCast<GlobalPtr<CacheEntry>>(currentStart);
 
     // initialize global resource state values
-    *m_head = FreeListNode{nullptr, nullptr, 0};
-    detail::InplaceMutex::initialize(m_mutex);
+    for (std::size_t sizeClass = 0; sizeClass < numSizeClasses; ++sizeClass) {
+      m_heads[sizeClass] = FreeListNode{nullptr, nullptr, 0};
+      detail::InplaceMutex::initialize(m_mutexes + sizeClass);
+    }
+    for (std::size_t cacheIndex = 0; cacheIndex < numCaches; ++cacheIndex) {
+      detail::InplaceMutex::initialize(m_cacheMutexes + cacheIndex);
+    }
+    for (std::size_t i = 0; i < numCachedSizes * numCaches; ++i) {
+      m_caches[i] = CacheEntry{nullptr, 0};
+    }
   }
 
   /**
@@ -91,17 +151,25 @@ public:
    */
   [[nodiscard]] GlobalPtr<void> allocate(std::size_t bytes,
                                          std::size_t = alignof(std::max_align_t)) {
-    detail::InplaceMutex::lock(m_mutex);
-    GlobalPtr<void> result(nullptr);
-    if (m_head->next != nullptr) {
-      auto bestMatchingBlock = findBestMatchingBlock(bytes);
-      // The head node is a sentinel node and can't be allocated
-      if (bestMatchingBlock != m_head) {
-        removeBlockFromList(bestMatchingBlock);
-        result = bestMatchingBlock;
+    const auto firstClass = sizeClassOf(bytes);
+
+    // blocks in the size class of the request may be smaller than the request
+    GlobalPtr<void> result = allocateBestMatchingBlock(firstClass, bytes);
+
+    // any block in a larger size class satisfies the request
+    for (auto sizeClass = firstClass + 1; (result == nullptr) && (sizeClass < numSizeClasses);
+         ++sizeClass) {
+      if ((m_heads + sizeClass)->next == nullptr) {
+        continue;
+      }
+      detail::InplaceMutex::lock(m_mutexes + sizeClass);
+      GlobalPtr<FreeListNode> block = (m_heads + sizeClass)->next;
+      if (block != nullptr) {
+        removeBlockFromList(block);
+        result = block;
       }
+      detail::InplaceMutex::unlock(m_mutexes + sizeClass);
     }
-    detail::InplaceMutex::unlock(m_mutex);
     return result;
   }
 
@@ -119,6 +187,170 @@ public:
     registerFreedBlock(p, bytes);
   }
 
+  /**
+   * @brief Checks if blocks of `bytes` bytes are kept in the caches.
+   *
+   * @note Only sizes from 256 B to 112 KiB that are multiples of a quarter of their power-of-two
+   *       size class (e.g., 256, 320, 384, 448, 512, 640, ...) are cacheable, so that each cache
+   *       entry holds blocks of a single size.
+   */
+  static constexpr bool isCacheableSize(std::size_t bytes) noexcept {
+    const auto sizeClass = sizeClassOf(bytes);
+    return (sizeClass >= minCachedSizeClass) && (sizeClass <= maxCachedSizeClass) &&
+           ((bytes & (sizeStepOf(sizeClass) - 1)) == 0);
+  }
+
+  /**
+   * @brief Returns the smallest cacheable size that can hold `bytes` or `bytes` if there is none.
+   *
+   * The rounded size is less than 25% larger than `bytes`.
+   */
+  static constexpr std::size_t roundToCacheableSize(std::size_t bytes) noexcept {
+    const auto sizeClass = sizeClassOf(bytes);
+    if ((sizeClass < minCachedSizeClass) || (sizeClass > maxCachedSizeClass)) {
+      return bytes;
+    }
+    const auto step = sizeStepOf(sizeClass);
+    const auto rounded = (bytes + step - 1) & ~(step - 1);
+    return isCacheableSize(rounded) ? rounded : bytes;
+  }
+
+  /**
+   * @brief Allocates `bytes` from cache @p cacheIndex.
+   *
+   * If the cache is empty, it is refilled with a batch of blocks from the shared lists.
+   *
+   * @note Cache @p cacheIndex should only be used by one thread of execution, so that its mutex
+   *       is only contended by @ref flushCaches.
+   *
+   * @param cacheIndex The index of the cache of the caller
+   * @param bytes The requested number of bytes; must satisfy @ref isCacheableSize
+   * @return A pointer to the allocated memory or `nullptr` if there is no free block of that size.
+   */
+  [[nodiscard]] GlobalPtr<void> allocateCached(std::size_t cacheIndex, std::size_t bytes) {
+    const auto sizeClass = sizeClassOf(bytes);
+    auto entryPtr = cacheEntryOf(cacheIndex, bytes);
+    detail::InplaceMutex::lock(m_cacheMutexes + cacheIndex);
+    CacheEntry entry = *entryPtr;
+    if (entry.count == 0) {
+      if ((m_heads + sizeClass)->next == nullptr) {
+        detail::InplaceMutex::unlock(m_cacheMutexes + cacheIndex);
+        return nullptr;
+      }
+      // refill the cache with a batch of blocks
+      detail::InplaceMutex::lock(m_mutexes + sizeClass);
+      GlobalPtr<FreeListNode> block = (m_heads + sizeClass)->next;
+      while ((block != nullptr) && (entry.count < cacheBatchSize)) {
+        const FreeListNode node = *block;
+        if (node.blockSize == bytes) {
+          removeBlockFromList(block);
+          block->next = entry.head;
+          entry.head = block;
+          ++entry.count;
+        }
+        block = node.next;
+      }
+      *entryPtr = entry;
+      detail::InplaceMutex::unlock(m_mutexes + sizeClass);
+      if (entry.count == 0) {
+        detail::InplaceMutex::unlock(m_cacheMutexes + cacheIndex);
+        return nullptr;
+      }
+    }
+
+    GlobalPtr<FreeListNode> result = entry.head;
+    entry.head = result->next;
+    --entry.count;
+    *entryPtr = entry;
+    detail::InplaceMutex::unlock(m_cacheMutexes + cacheIndex);
+    return result;
+  }
+
+  /**
+   * @brief Deallocates the storage pointed to by a pointer to cache @p cacheIndex.
+   *
+   * If the cache grows past twice its batch size, a batch of blocks is returned to the shared
+   * lists.
+   *
+   * @note Cache @p cacheIndex should only be used by one thread of execution, so that its mutex
+   *       is only contended by @ref flushCaches.
+   *
+   * @param cacheIndex The index of the cache of the caller
+   * @param p Pointer to the storage to be deallocated
+   * @param bytes The number of bytes that the pointer points to; must satisfy
+   *              @ref isCacheableSize
+   */
+  void deallocateCached(std::size_t cacheIndex, GlobalPtr<void> p, std::size_t bytes) {
+    checkFreedBlock(p, bytes);
+
+    const auto sizeClass = sizeClassOf(bytes);
+    auto entryPtr = cacheEntryOf(cacheIndex, bytes);
+    detail::InplaceMutex::lock(m_cacheMutexes + cacheIndex);
+    CacheEntry entry = *entryPtr;
+
+    auto block = static_cast<GlobalPtr<FreeListNode>>(p);
+    *block = FreeListNode{entry.head, nullptr, bytes};
+    entry.head = block;
+    ++entry.count;
+    *entryPtr = entry;
+
+    if (entry.count > 2 * cacheBatchSize) {
+      // return a batch of blocks to the shared list
+      detail::InplaceMutex::lock(m_mutexes + sizeClass);
+      for (std::uint64_t i = 0; (i < cacheBatchSize) && (entry.count > 0); ++i) {
+        GlobalPtr<FreeListNode> returned = entry.head;
+        entry.head = returned->next;
+        --entry.count;
+        addBlock(sizeClass, returned, bytes);
+      }
+      *entryPtr = entry;
+      detail::InplaceMutex::unlock(m_mutexes + sizeClass);
+    }
+    detail::InplaceMutex::unlock(m_cacheMutexes + cacheIndex);
+  }
+
+  /**
+   * @brief Returns the blocks of all caches to the shared lists.
+   *
+   * This is the reclaim path for when the shared lists cannot satisfy a request but other caches
+   * may hold blocks of the requested size. It can be called by any thread of execution.
+   *
+   * @return The number of blocks returned to the shared lists.
+   */
+  std::size_t flushCaches() {
+    std::size_t numFlushed = 0;
+    for (std::size_t cacheIndex = 0; cacheIndex < m_numCaches; ++cacheIndex) {
+      detail::InplaceMutex::lock(m_cacheMutexes + cacheIndex);
+      for (std::size_t sizeIndex = 0; sizeIndex < numCachedSizes; ++sizeIndex) {
+        auto entryPtr = m_caches + (cacheIndex * numCachedSizes + sizeIndex);
+        CacheEntry entry = *entryPtr;
+        if (entry.count == 0) {
+          continue;
+        }
+        const auto bytes = cachedSizeOf(sizeIndex);
+        const auto sizeClass = sizeClassOf(bytes);
+        detail::InplaceMutex::lock(m_mutexes + sizeClass);
+        while (entry.head != nullptr) {
+          GlobalPtr<FreeListNode> returned = entry.head;
+          entry.head = returned->next;
+          addBlock(sizeClass, returned, bytes);
+        }
+        detail::InplaceMutex::unlock(m_mutexes + sizeClass);
+        numFlushed += entry.count;
+        *entryPtr = CacheEntry{nullptr, 0};
+      }
+      detail::InplaceMutex::unlock(m_cacheMutexes + cacheIndex);
+    }
+    return numFlushed;
+  }
+
+  /**
+   * @brief Returns the number of caches of the resource.
+   */
+  std::size_t getNumCaches() const noexcept {
+    return m_numCaches;
+  }
+
   /**
    * @brief Equality comparison between two free-list memory resources
    *
@@ -128,7 +360,7 @@ public:
    */
 
   bool operator==(const FreeListMemoryResource& rhs) const noexcept {
-    return (m_head == rhs.m_head);
+    return (m_heads == rhs.m_heads);
   }
 
   /**
@@ -168,10 +400,13 @@ public:
   /**
    * @brief Computes the metadata size required by the resource.
    *
+   * @param numCaches The number of caches of the resource.
+   *
    * @return constexpr std::size_t number of bytes for the memory resource.
    */
-  static constexpr std::size_t computeMetadataSize() {
-    return sizeof(FreeListNode) + sizeof(MutexValueType);
+  static constexpr std::size_t computeMetadataSize(std::size_t numCaches = 0) {
+    return (sizeof(FreeListNode) + sizeof(MutexValueType)) * numSizeClasses +
+           (sizeof(MutexValueType) + sizeof(CacheEntry) * numCachedSizes) * numCaches;
   }
 
   /**
@@ -193,6 +428,45 @@ public:
    * @param bytes The number of bytes that the pointer @p p points to.
    */
   void registerFreedBlock(GlobalPtr<void> p, std::size_t bytes) {
+    checkFreedBlock(p, bytes);
+
+    const auto sizeClass = sizeClassOf(bytes);
+    detail::InplaceMutex::lock(m_mutexes + sizeClass);
+    auto newBlockPtr = static_cast<GlobalPtr<FreeListNode>>(p);
+    addBlock(sizeClass, newBlockPtr, bytes);
+    detail::InplaceMutex::unlock(m_mutexes + sizeClass);
+  }
+
+private:
+  static constexpr std::size_t sizeClassOf(std::size_t bytes) noexcept {
+    const std::size_t sizeClass = (bytes == 0) ? 0 : (std::bit_width(bytes) - 1);
+    return (sizeClass < numSizeClasses) ? sizeClass : (numSizeClasses - 1);
+  }
+
+  static constexpr std::size_t sizeStepOf(std::size_t sizeClass) noexcept {
+    return std::size_t{1} << (sizeClass - cachedSizeStepsLog2);
+  }
+
+  // inverse of the size index computed by cacheEntryOf
+  static constexpr std::size_t cachedSizeOf(std::size_t sizeIndex) noexcept {
+    const auto sizeClass = minCachedSizeClass + (sizeIndex >> cachedSizeStepsLog2);
+    const auto step = (std::size_t{1} << cachedSizeStepsLog2) +
+                      (sizeIndex & ((std::size_t{1} << cachedSizeStepsLog2) - 1));
+    return step * sizeStepOf(sizeClass);
+  }
+
+  GlobalPtr<CacheEntry> cacheEntryOf(std::size_t cacheIndex, std::size_t bytes) const {
+    if ((cacheIndex >= m_numCaches) || !isCacheableSize(bytes)) {
+      PANDO_ABORT("Invalid free list cache access");
+    }
+    // the cacheable sizes of a size class are 4, 5, 6 and 7 times its size step
+    const auto sizeClass = sizeClassOf(bytes);
+    const auto step = bytes / sizeStepOf(sizeClass) - (std::size_t{1} << cachedSizeStepsLog2);
+    const auto sizeIndex = ((sizeClass - minCachedSizeClass) << cachedSizeStepsLog2) + step;
+    return m_caches + (cacheIndex * numCachedSizes + sizeIndex);
+  }
+
+  static void checkFreedBlock(GlobalPtr<void> p, std::size_t bytes) {
     if ((p == nullptr) || (bytes < sizeof(FreeListNode))) {
       PANDO_ABORT("Insufficient space to store node metadata");
     }
@@ -206,16 +480,26 @@ public:
     if (!pointerSatisfyAlignment) {
       PANDO_ABORT("FreeList required pointer alignment is not maintained");
     }
+  }
 
-    detail::InplaceMutex::lock(m_mutex);
-    auto newBlockPtr = static_cast<GlobalPtr<FreeListNode>>(p);
-    addBlock(newBlockPtr, bytes);
-    detail::InplaceMutex::unlock(m_mutex);
+  GlobalPtr<void> allocateBestMatchingBlock(std::size_t sizeClass, std::size_t bytes) {
+    if ((m_heads + sizeClass)->next == nullptr) {
+      return nullptr;
+    }
+    detail::InplaceMutex::lock(m_mutexes + sizeClass);
+    GlobalPtr<void> result(nullptr);
+    auto bestMatchingBlock = findBestMatchingBlock(sizeClass, bytes);
+    // The head node is a sentinel node and can't be allocated
+    if (bestMatchingBlock != m_heads + sizeClass) {
+      removeBlockFromList(bestMatchingBlock);
+      result = bestMatchingBlock;
+    }
+    detail::InplaceMutex::unlock(m_mutexes + sizeClass);
+    return result;
   }
 
-private:
-  GlobalPtr<FreeListNode> findBestMatchingBlock(std::size_t bytes) const {
-    auto current = m_head;
+  GlobalPtr<FreeListNode> findBestMatchingBlock(std::size_t sizeClass, std::size_t bytes) const {
+    auto current = m_heads + sizeClass;
     auto bestNode = current;
     auto bestDiff = std::numeric_limits<std::size_t>::max();
     while (current != nullptr) {
@@ -245,18 +529,19 @@ private:
       next->previous = previous;
     }
   }
-  void addBlock(GlobalPtr<FreeListNode> nodePtr, std::size_t bytes) {
+  void addBlock(std::size_t sizeClass, GlobalPtr<FreeListNode> nodePtr, std::size_t bytes) {
     // insert the new memory block at the beginning of the linked list
-    auto nextNode = m_head->next;
+    auto head = m_heads + sizeClass;
+    auto nextNode = head->next;
     if (nextNode != nullptr) {
       nextNode->previous = nodePtr;
     }
 
-    nodePtr->previous = m_head;
+    nodePtr->previous = head;
     nodePtr->next = nextNode;
     nodePtr->blockSize = bytes;
 
-    m_head->next = nodePtr;
+    head->next = nodePtr;
   }
 };
 
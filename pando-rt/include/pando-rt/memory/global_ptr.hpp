@@ -5,6 +5,7 @@
 #define PANDO_RT_MEMORY_GLOBAL_PTR_HPP_
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -14,6 +15,7 @@
 #include "address_translation.hpp"
 #include "export.h"
 #include "global_ptr_fwd.hpp"
+#include "translation_cache.hpp"
 #ifdef PANDO_RT_USE_BACKEND_DRVX
 #include "DrvAPIMemory.hpp"
 #include "DrvAPIOp.hpp"
@@ -50,7 +52,55 @@ PANDO_RT_EXPORT void store(GlobalAddress globalAddr, std::size_t n, const void*
 
 PANDO_RT_EXPORT void bulkMemcpy(GlobalAddress srcGlobalAddr, std::size_t n, GlobalAddress dstGlobalAddr);
 
-#if defined(PANDO_RT_USE_BACKEND_DRVX)
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+
+/**
+ * @brief Performs a load of a @p T from a pointer in the global address space to space in the native
+ *        address space.
+ *
+ * Loads from the main or L2SP memory of this node are performed inline with a copy of constant
+ * size. Loads from remote nodes and from L1SP use the generic @ref load.
+ *
+ * @param[in]  globalAddr global address to read from
+ * @param[out] nativePtr  native pointer to write to
+ *
+ * @ingroup PREP
+ */
+template <typename T>
+void load(GlobalAddress globalAddr, void* nativePtr) {
+#ifndef PANDO_MEM_TRACE_OR_STAT
+  if (auto srcNativePtr = localToNative(globalAddr); srcNativePtr != nullptr) {
+    std::memcpy(nativePtr, srcNativePtr, sizeof(T));
+    return;
+  }
+#endif // PANDO_MEM_TRACE_OR_STAT
+  load(globalAddr, sizeof(T), nativePtr);
+}
+
+/**
+ * @brief Performs a store of a @p T from a pointer to the native address space to space in the
+ *        global address space.
+ *
+ * Stores to the main or L2SP memory of this node are performed inline with a copy of constant size.
+ * Stores to remote nodes and to L1SP use the generic @ref store.
+ *
+ * @param[out] globalAddr global address to write to
+ * @param[in]  nativePtr  native pointer to read from
+ *
+ * @ingroup PREP
+ */
+template <typename T>
+void store(GlobalAddress globalAddr, const void* nativePtr) {
+#ifndef PANDO_MEM_TRACE_OR_STAT
+  if (auto dstNativePtr = localToNative(globalAddr); dstNativePtr != nullptr) {
+    std::memcpy(dstNativePtr, nativePtr, sizeof(T));
+    return;
+  }
+#endif // PANDO_MEM_TRACE_OR_STAT
+  store(globalAddr, sizeof(T), nativePtr);
+}
+
+#elif defined(PANDO_RT_USE_BACKEND_DRVX)
 
 /**
  * @brief Performs a load from a pointer in the global address space to space in the native address
@@ -66,10 +116,7 @@ void load(GlobalAddress globalAddr, void* nativePtr) {
   T* destPtr = static_cast<T*>(nativePtr);
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(globalAddr, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(translateToNative(globalAddr));
     *destPtr = *as_native_pointer;
     // hartYield
     DrvAPI::nop(1u);
@@ -95,10 +142,7 @@ void store(GlobalAddress globalAddr, const void* nativePtr) {
   const T* srcPtr = static_cast<const T*>(nativePtr);
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(globalAddr, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    auto as_native_pointer = static_cast<std::remove_cv_t<T>*>(translateToNative(globalAddr));
     *as_native_pointer = *srcPtr;
     // hartYield
     DrvAPI::nop(1u);
@@ -169,9 +213,35 @@ PANDO_RT_EXPORT void* asNativePtr(GlobalAddress globalAddr) noexcept;
  */
 template <typename T>
 T* asNativePtr(GlobalPtr<T> globalPtr) noexcept {
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+  if (auto nativePtr = localToNative(globalPtr.address); nativePtr != nullptr) {
+    return static_cast<T*>(nativePtr);
+  }
+#endif // PANDO_RT_USE_BACKEND_PREP
   return static_cast<T*>(asNativePtr(globalPtr.address));
 }
 
+/**
+ * @brief Creates a global pointer from a native pointer.
+ *
+ * Pointers to the main memory of this node are translated inline, all others with
+ * @ref createGlobalAddress.
+ *
+ * @param[in] nativePtr native pointer
+ *
+ * @return global pointer that encodes @p nativePtr to the global address pointer space
+ *
+ * @ingroup ROOT
+ */
+inline GlobalAddress toGlobalAddress(void* nativePtr) noexcept {
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+  if (auto addr = localMainToGlobal(nativePtr); addr != GlobalAddress{}) {
+    return addr;
+  }
+#endif // PANDO_RT_USE_BACKEND_PREP
+  return createGlobalAddress(nativePtr);
+}
+
 } // namespace detail
 
 /**
@@ -480,14 +550,14 @@ struct GlobalPtr<const void> {
 
 template <typename T>
 GlobalPtr<T>::GlobalPtr(T* nativePtr) // NOLINT - implicit conversion expected
-    : address(detail::createGlobalAddress(const_cast<std::remove_cv_t<T>*>(nativePtr))) {}
+    : address(detail::toGlobalAddress(const_cast<std::remove_cv_t<T>*>(nativePtr))) {}
 
 inline GlobalPtr<void>::GlobalPtr(void* nativePtr) // NOLINT - implicit conversion expected
-    : address(detail::createGlobalAddress(nativePtr)) {}
+    : address(detail::toGlobalAddress(nativePtr)) {}
 
 inline GlobalPtr<const void>::GlobalPtr(
     const void* nativePtr) // NOLINT - implicit conversion expected
-    : address(detail::createGlobalAddress(const_cast<void*>(nativePtr))) {}
+    : address(detail::toGlobalAddress(const_cast<void*>(nativePtr))) {}
 
 // addition operators
 
@@ -789,7 +859,7 @@ public:
     alignas(ObjectT) std::byte storage[sizeof(ObjectT)];
     auto nativePtr = reinterpret_cast<ObjectT*>(&storage[0]);
 #if defined(PANDO_RT_USE_BACKEND_PREP)
-    detail::load(m_globalPtr.address, sizeof(ObjectT), nativePtr);
+    detail::load<ObjectT>(m_globalPtr.address, nativePtr);
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 #if defined(PANDO_RT_USE_DMA)
     detail::load<ObjectT>(m_globalPtr.address, nativePtr);
@@ -840,7 +910,7 @@ public:
 
   GlobalRef operator=(const T& value) {
 #if defined(PANDO_RT_USE_BACKEND_PREP)
-    detail::store(m_globalPtr.address, sizeof(T), std::addressof(value));
+    detail::store<T>(m_globalPtr.address, std::addressof(value));
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 #if defined(PANDO_RT_USE_DMA)
     detail::store<T>(m_globalPtr.address, std::addressof(value));
@@ -861,7 +931,7 @@ public:
   GlobalRef operator=(U&& value) {
     T tmp = std::forward<U>(value);
 #if defined(PANDO_RT_USE_BACKEND_PREP)
-    detail::store(m_globalPtr.address, sizeof(T), std::addressof(tmp));
+    detail::store<T>(m_globalPtr.address, std::addressof(tmp));
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 #if defined(PANDO_RT_USE_DMA)
     detail::store<T>(m_globalPtr.address, std::addressof(tmp));
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
+
+#ifndef PANDO_RT_MEMORY_TRANSLATION_CACHE_HPP_
+#define PANDO_RT_MEMORY_TRANSLATION_CACHE_HPP_
+
+#include <array>
+#include <cstddef>
+
+#include "address_translation.hpp"
+#include "export.h"
+#include "global_ptr_fwd.hpp"
+#ifdef PANDO_RT_USE_BACKEND_DRVX
+#include "DrvAPIAddressMap.hpp"
+#include "DrvAPIAddressToNative.hpp"
+#endif // PANDO_RT_USE_BACKEND_DRVX
+
+namespace pando {
+
+namespace detail {
+
+/**
+ * @brief Small cache of translations from global address ranges to native memory.
+ *
+ * Each entry maps a range of global addresses to the native memory that backs it contiguously. The
+ * cache is fully associative and replaces entries in round-robin order.
+ *
+ * @ingroup ROOT
+ */
+class TranslationCache {
+  struct Entry {
+    GlobalAddress begin{};
+    std::byte* native{};
+    std::size_t size{};
+  };
+
+  std::array<Entry, 8> m_entries{};
+  std::size_t m_next{};
+
+public:
+  /**
+   * @brief Returns the native pointer that corresponds to @p addr or @c nullptr if it is not in the
+   *        cache.
+   */
+  void* find(GlobalAddress addr) const noexcept {
+    std::size_t size = 0;
+    return find(addr, size);
+  }
+
+  /**
+   * @brief Returns the native pointer that corresponds to @p addr or @c nullptr if it is not in the
+   *        cache, and sets @p size to the number of bytes cached from it.
+   */
+  void* find(GlobalAddress addr, std::size_t& size) const noexcept {
+    for (const auto& entry : m_entries) {
+      // empty entries have a size of 0 and never match
+      if (addr - entry.begin < entry.size) {
+        size = entry.size - (addr - entry.begin);
+        return entry.native + (addr - entry.begin);
+      }
+    }
+    size = 0;
+    return nullptr;
+  }
+
+  /**
+   * @brief Adds that the @p size bytes starting at @p addr are backed by the native memory at
+   *        @p native.
+   */
+  void insert(GlobalAddress addr, void* native, std::size_t size) noexcept {
+    m_entries[m_next] = Entry{addr, static_cast<std::byte*>(native), size};
+    m_next = (m_next + 1) % m_entries.size();
+  }
+
+  /**
+   * @brief Removes all entries.
+   */
+  void clear() noexcept {
+    m_entries = {};
+    m_next = 0;
+  }
+};
+
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+
+/**
+ * @brief Memory of this node that is a single native allocation.
+ *
+ * Translation between such memory and its global addresses is an offset. It is empty before the
+ * memory subsystem is initialized.
+ *
+ * @ingroup PREP
+ */
+struct LocalMemory {
+  /// @brief Global address of the first byte
+  GlobalAddress globalBase{};
+  /// @brief Native address of the first byte
+  std::byte* nativeBase{};
+  /// @brief Size in bytes
+  std::size_t byteCount{};
+};
+
+/**
+ * @brief Main memory of this node.
+ *
+ * @ingroup PREP
+ */
+extern PANDO_RT_EXPORT LocalMemory localMainMemory;
+
+/**
+ * @brief L2SP memory of this node, with the global base address of pod @c 0.
+ *
+ * @ingroup PREP
+ */
+extern PANDO_RT_EXPORT LocalMemory localL2SPMemory;
+
+/**
+ * @brief Returns the native pointer of @p addr if it is in the main memory of this node, otherwise
+ *        @c nullptr.
+ *
+ * @ingroup PREP
+ */
+inline void* localMainToNative(GlobalAddress addr) noexcept {
+  const auto offset = addr - localMainMemory.globalBase;
+  if (offset < localMainMemory.byteCount) {
+    return localMainMemory.nativeBase + offset;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Returns the global address of @p nativePtr if it points to the main memory of this node,
+ *        otherwise @c 0.
+ *
+ * @ingroup PREP
+ */
+inline GlobalAddress localMainToGlobal(const void* nativePtr) noexcept {
+  const auto offset = static_cast<std::size_t>(static_cast<const std::byte*>(nativePtr) -
+                                               localMainMemory.nativeBase);
+  if (nativePtr != nullptr && offset < localMainMemory.byteCount) {
+    return localMainMemory.globalBase + offset;
+  }
+  return GlobalAddress{};
+}
+
+/**
+ * @brief Returns the native pointer of @p addr if it is in the L2SP memory of this node, otherwise
+ *        @c nullptr.
+ *
+ * @ingroup PREP
+ */
+inline void* localL2SPToNative(GlobalAddress addr) noexcept {
+  // all pods of a node share the same memory, so the pod index is ignored
+  constexpr auto podMask = createMask(addressMap.L2SP.podX, ~GlobalAddress{0}) |
+                           createMask(addressMap.L2SP.podY, ~GlobalAddress{0});
+  const auto offset = (addr & ~podMask) - localL2SPMemory.globalBase;
+  if (offset < localL2SPMemory.byteCount) {
+    return localL2SPMemory.nativeBase + offset;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Returns the native pointer of @p addr if it is in the main or L2SP memory of this node,
+ *        otherwise @c nullptr.
+ *
+ * @ingroup PREP
+ */
+inline void* localToNative(GlobalAddress addr) noexcept {
+  if (auto nativePtr = localMainToNative(addr); nativePtr != nullptr) {
+    return nativePtr;
+  }
+  return localL2SPToNative(addr);
+}
+
+#elif defined(PANDO_RT_USE_BACKEND_DRVX)
+
+/**
+ * @brief Translations of the harts that run on this thread.
+ *
+ * Only absolute addresses are cached, since relative L1SP and L2SP addresses translate differently
+ * for harts on different cores.
+ *
+ * @ingroup DRVX
+ */
+inline thread_local TranslationCache translationCache;
+
+/**
+ * @brief Returns the native pointer of @p addr using the translation cache of the calling hart, and
+ *        sets @p size to the number of bytes from it that are contiguous in native memory.
+ *
+ * A transfer of @c n bytes needs one translation per contiguous range instead of one per block.
+ *
+ * @ingroup DRVX
+ */
+inline void* translateRangeToNative(GlobalAddress addr, std::size_t& size) {
+  if (auto nativePtr = translationCache.find(addr, size); nativePtr != nullptr) {
+    return nativePtr;
+  }
+  void* nativePtr = nullptr;
+  DrvAPI::DrvAPIAddressToNative(addr, &nativePtr, &size);
+  DrvAPI::DrvAPIVAddress vaddr = addr;
+  if (vaddr.not_scratchpad() || vaddr.global()) {
+    translationCache.insert(addr, nativePtr, size);
+  }
+  return nativePtr;
+}
+
+/**
+ * @brief Returns the native pointer of @p addr using the translation cache of the calling hart.
+ *
+ * @ingroup DRVX
+ */
+inline void* translateToNative(GlobalAddress addr) {
+  std::size_t size = 0;
+  return translateRangeToNative(addr, size);
+}
+
+#endif // PANDO_RT_USE_BACKEND_PREP
+
+} // namespace detail
+
+} // namespace pando
+
+#endif // PANDO_RT_MEMORY_TRANSLATION_CACHE_HPP_
@@ -47,8 +47,10 @@ struct MainMemoryResourceRatioBreakdown {
    *
    * @param bufferStart A pointer to the start of the main memory buffer.
    * @param bufferSize The size of the main memory buffer.
+   * @param numCaches The number of caches of the free-list resource.
    */
-  MainMemoryResourceRatioBreakdown(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize);
+  MainMemoryResourceRatioBreakdown(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize,
+                                   std::size_t numCaches = 0);
 };
 
 /**
@@ -191,8 +193,11 @@ public:
    *
    * @param bufferStart Pointer to the region of memory that is managed by the resource.
    * @param bufferSize The size of the buffer that the resource will manage.
+   * @param numCaches The number of per-hart caches of freed blocks; harts without a cache use the
+   *                  shared free lists only.
    */
-  MainMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize);
+  MainMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize,
+                     std::size_t numCaches = 0);
 
   /**
    * @brief Copy constructor is deleted.
@@ -237,6 +237,108 @@ PANDO_RT_EXPORT std::int64_t atomicFetchSub(GlobalPtr<std::int64_t> ptr, std::in
 PANDO_RT_EXPORT std::uint64_t atomicFetchSub(GlobalPtr<std::uint64_t> ptr, std::uint64_t value,
                                              std::memory_order order);
 
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the minimum of it and @p value
+ *        and returns the previous value held.
+ *
+ * The object is only written if @p value is smaller. A remote object is updated with a single
+ * message to the node that owns it.
+ *
+ * @param[inout] ptr   pointer to the object to modify
+ * @param[in]    value value to compare with the object pointed to by @p ptr
+ * @param[in]    order memory order to use
+ *
+ * @return value before the operation
+ *
+ * @ingroup ROOT
+ */
+PANDO_RT_EXPORT std::int32_t atomicFetchMin(GlobalPtr<std::int32_t> ptr, std::int32_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchMin(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint32_t atomicFetchMin(GlobalPtr<std::uint32_t> ptr, std::uint32_t value,
+                                             std::memory_order order);
+/// @copydoc atomicFetchMin(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::int64_t atomicFetchMin(GlobalPtr<std::int64_t> ptr, std::int64_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchMin(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint64_t atomicFetchMin(GlobalPtr<std::uint64_t> ptr, std::uint64_t value,
+                                             std::memory_order order);
+
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the maximum of it and @p value
+ *        and returns the previous value held.
+ *
+ * The object is only written if @p value is larger. A remote object is updated with a single
+ * message to the node that owns it.
+ *
+ * @param[inout] ptr   pointer to the object to modify
+ * @param[in]    value value to compare with the object pointed to by @p ptr
+ * @param[in]    order memory order to use
+ *
+ * @return value before the operation
+ *
+ * @ingroup ROOT
+ */
+PANDO_RT_EXPORT std::int32_t atomicFetchMax(GlobalPtr<std::int32_t> ptr, std::int32_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchMax(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint32_t atomicFetchMax(GlobalPtr<std::uint32_t> ptr, std::uint32_t value,
+                                             std::memory_order order);
+/// @copydoc atomicFetchMax(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::int64_t atomicFetchMax(GlobalPtr<std::int64_t> ptr, std::int64_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchMax(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint64_t atomicFetchMax(GlobalPtr<std::uint64_t> ptr, std::uint64_t value,
+                                             std::memory_order order);
+
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the bitwise OR of it and
+ *        @p value and returns the previous value held.
+ *
+ * @param[inout] ptr   pointer to the object to modify
+ * @param[in]    value value to OR with the object pointed to by @p ptr
+ * @param[in]    order memory order to use
+ *
+ * @return value before the operation
+ *
+ * @ingroup ROOT
+ */
+PANDO_RT_EXPORT std::int32_t atomicFetchOr(GlobalPtr<std::int32_t> ptr, std::int32_t value,
+                                           std::memory_order order);
+/// @copydoc atomicFetchOr(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint32_t atomicFetchOr(GlobalPtr<std::uint32_t> ptr, std::uint32_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchOr(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::int64_t atomicFetchOr(GlobalPtr<std::int64_t> ptr, std::int64_t value,
+                                           std::memory_order order);
+/// @copydoc atomicFetchOr(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint64_t atomicFetchOr(GlobalPtr<std::uint64_t> ptr, std::uint64_t value,
+                                            std::memory_order order);
+
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the bitwise AND of it and
+ *        @p value and returns the previous value held.
+ *
+ * @param[inout] ptr   pointer to the object to modify
+ * @param[in]    value value to AND with the object pointed to by @p ptr
+ * @param[in]    order memory order to use
+ *
+ * @return value before the operation
+ *
+ * @ingroup ROOT
+ */
+PANDO_RT_EXPORT std::int32_t atomicFetchAnd(GlobalPtr<std::int32_t> ptr, std::int32_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchAnd(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint32_t atomicFetchAnd(GlobalPtr<std::uint32_t> ptr, std::uint32_t value,
+                                             std::memory_order order);
+/// @copydoc atomicFetchAnd(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::int64_t atomicFetchAnd(GlobalPtr<std::int64_t> ptr, std::int64_t value,
+                                            std::memory_order order);
+/// @copydoc atomicFetchAnd(GlobalPtr<std::int32_t>,std::int32_t,std::memory_order)
+PANDO_RT_EXPORT std::uint64_t atomicFetchAnd(GlobalPtr<std::uint64_t> ptr, std::uint64_t value,
+                                             std::memory_order order);
+
 /**
  * @brief Establish a memory synchronization ordering of non-atomic and relaxed atomic
  *        operations and using the @p order semantics.
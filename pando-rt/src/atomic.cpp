@@ -6,12 +6,15 @@
 
 #include "pando-rt/memory/global_ptr.hpp"
 
+#include "native_atomic.hpp"
+
 #if defined(PANDO_RT_USE_BACKEND_PREP)
 #include "pando-rt/stdlib.hpp"
 #include "prep/cores.hpp"
 #include "prep/hart_context_fwd.hpp"
 #include "prep/log.hpp"
 #include "prep/memory.hpp"
+#include "prep/memtrace_stat.hpp"
 #include "prep/nodes.hpp"
 #include "prep/status.hpp"
 #if PANDO_MEM_TRACE_OR_STAT
@@ -78,7 +81,8 @@ T atomicLoadImpl(GlobalPtr<const T> ptr, [[maybe_unused]] std::memory_order orde
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_LOAD", nodeIdx, nodeIdx, sizeof(T), srcNativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicLoad, nodeIdx, nodeIdx, sizeof(T), srcNativePtr,
+                        ptr.address);
 #endif
 
     return value;
@@ -145,7 +149,8 @@ void atomicStoreImpl(GlobalPtr<T> ptr, const T value, [[maybe_unused]] std::memo
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_STORE", nodeIdx, nodeIdx, sizeof(T), dstNativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicStore, nodeIdx, nodeIdx, sizeof(T), dstNativePtr,
+                        ptr.address);
 #endif
   } else {
     // remote store
@@ -212,7 +217,7 @@ bool atomicCompareExchangeImpl(GlobalPtr<T> ptr, T& expected, const T desired,
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_COMPARE_EXCHANGE", nodeIdx, nodeIdx, sizeof(T), nativePtr,
+    MemTraceLogger::log(MemTraceOp::AtomicCompareExchange, nodeIdx, nodeIdx, sizeof(T), nativePtr,
                         ptr.address);
 #endif
 
@@ -254,10 +259,7 @@ bool atomicCompareExchangeImpl(GlobalPtr<T> ptr, T& expected, const T desired,
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(ptr.address, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
     auto result = __atomic_compare_exchange_n(as_native_pointer, &expected, desired, false, static_cast<int>(std::memory_order_relaxed), static_cast<int>(std::memory_order_relaxed));
     hartYield(1);
 
@@ -323,7 +325,8 @@ void atomicIncrementImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_INCREMENT", nodeIdx, nodeIdx, sizeof(T), nativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicIncrement, nodeIdx, nodeIdx, sizeof(T), nativePtr,
+                        ptr.address);
 #endif
   } else {
     // remote increment
@@ -350,10 +353,7 @@ void atomicIncrementImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(ptr.address, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
     __atomic_fetch_add(as_native_pointer, value, static_cast<int>(std::memory_order_relaxed));
     hartYield(1);
   } else {
@@ -393,7 +393,8 @@ void atomicDecrementImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_DECREMENT", nodeIdx, nodeIdx, sizeof(T), nativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicDecrement, nodeIdx, nodeIdx, sizeof(T), nativePtr,
+                        ptr.address);
 #endif
   } else {
     // remote decrement
@@ -420,10 +421,7 @@ void atomicDecrementImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(ptr.address, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
     __atomic_fetch_add(as_native_pointer, static_cast<T>(-1) * value, static_cast<int>(std::memory_order_relaxed));
     hartYield(1);
   } else {
@@ -463,7 +461,8 @@ T atomicFetchAddImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory_ord
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_FETCH_ADD", nodeIdx, nodeIdx, sizeof(T), nativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicFetchAdd, nodeIdx, nodeIdx, sizeof(T), nativePtr,
+                        ptr.address);
 #endif
     return result;
   } else {
@@ -493,10 +492,7 @@ T atomicFetchAddImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory_ord
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(ptr.address, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
     auto result = __atomic_fetch_add(as_native_pointer, value, static_cast<int>(std::memory_order_relaxed));
     hartYield(1);
     return result;
@@ -537,7 +533,8 @@ T atomicFetchSubImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory_ord
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("ATOMIC_FETCH_SUB", nodeIdx, nodeIdx, sizeof(T), nativePtr, ptr.address);
+    MemTraceLogger::log(MemTraceOp::AtomicFetchSub, nodeIdx, nodeIdx, sizeof(T), nativePtr,
+                        ptr.address);
 #endif
 
     return result;
@@ -568,10 +565,7 @@ T atomicFetchSubImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory_ord
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    void *addr_native = nullptr;
-    std::size_t size = 0;
-    DrvAPI::DrvAPIAddressToNative(ptr.address, &addr_native, &size);
-    T* as_native_pointer = reinterpret_cast<T*>(addr_native);
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
     auto result = __atomic_fetch_add(as_native_pointer, static_cast<T>(-1) * value, static_cast<int>(std::memory_order_relaxed));
     hartYield(1);
     return result;
@@ -597,6 +591,178 @@ INSTANTIATE_ATOMIC_FETCH_SUB(std::uint64_t)
 
 #undef INSTANTIATE_ATOMIC_FETCH_SUB
 
+// Atomic fetch-min operation
+struct FetchMinOp {
+  template <typename T>
+  static T native(T* ptr, T value, int memOrder) noexcept {
+    return nativeAtomicFetchMin(ptr, value, memOrder);
+  }
+
+#ifdef PANDO_RT_USE_BACKEND_PREP
+  static constexpr MemTraceOp memTraceOp = MemTraceOp::AtomicFetchMin;
+
+  template <typename T>
+  static Status remote(NodeIndex nodeIdx, GlobalAddress addr, T value,
+                       Nodes::ValueHandle<T>& handle) {
+    return Nodes::atomicFetchMin<T>(nodeIdx, addr, value, handle);
+  }
+#else
+  template <typename T>
+  static T simulated(GlobalAddress addr, T value) {
+    return DrvAPI::atomic_min(addr, value);
+  }
+#endif
+};
+
+// Atomic fetch-max operation
+struct FetchMaxOp {
+  template <typename T>
+  static T native(T* ptr, T value, int memOrder) noexcept {
+    return nativeAtomicFetchMax(ptr, value, memOrder);
+  }
+
+#ifdef PANDO_RT_USE_BACKEND_PREP
+  static constexpr MemTraceOp memTraceOp = MemTraceOp::AtomicFetchMax;
+
+  template <typename T>
+  static Status remote(NodeIndex nodeIdx, GlobalAddress addr, T value,
+                       Nodes::ValueHandle<T>& handle) {
+    return Nodes::atomicFetchMax<T>(nodeIdx, addr, value, handle);
+  }
+#else
+  template <typename T>
+  static T simulated(GlobalAddress addr, T value) {
+    return DrvAPI::atomic_max(addr, value);
+  }
+#endif
+};
+
+// Atomic fetch-or operation
+struct FetchOrOp {
+  template <typename T>
+  static T native(T* ptr, T value, int memOrder) noexcept {
+    return __atomic_fetch_or(ptr, value, memOrder);
+  }
+
+#ifdef PANDO_RT_USE_BACKEND_PREP
+  static constexpr MemTraceOp memTraceOp = MemTraceOp::AtomicFetchOr;
+
+  template <typename T>
+  static Status remote(NodeIndex nodeIdx, GlobalAddress addr, T value,
+                       Nodes::ValueHandle<T>& handle) {
+    return Nodes::atomicFetchOr<T>(nodeIdx, addr, value, handle);
+  }
+#else
+  template <typename T>
+  static T simulated(GlobalAddress addr, T value) {
+    return DrvAPI::atomic_or(addr, value);
+  }
+#endif
+};
+
+// Atomic fetch-and operation
+struct FetchAndOp {
+  template <typename T>
+  static T native(T* ptr, T value, int memOrder) noexcept {
+    return __atomic_fetch_and(ptr, value, memOrder);
+  }
+
+#ifdef PANDO_RT_USE_BACKEND_PREP
+  static constexpr MemTraceOp memTraceOp = MemTraceOp::AtomicFetchAnd;
+
+  template <typename T>
+  static Status remote(NodeIndex nodeIdx, GlobalAddress addr, T value,
+                       Nodes::ValueHandle<T>& handle) {
+    return Nodes::atomicFetchAnd<T>(nodeIdx, addr, value, handle);
+  }
+#else
+  template <typename T>
+  static T simulated(GlobalAddress addr, T value) {
+    return DrvAPI::atomic_and(addr, value);
+  }
+#endif
+};
+
+// Applies the read-modify-write operation Op to the object pointed to by ptr and returns its
+// previous value; remote objects are modified with a single message to the node that owns them
+template <typename Op, typename T>
+T atomicFetchOpImpl(GlobalPtr<T> ptr, T value, [[maybe_unused]] std::memory_order order) {
+#ifdef PANDO_RT_USE_BACKEND_PREP
+
+  const auto nodeIdx = extractNodeIndex(ptr.address);
+  if (nodeIdx == Nodes::getCurrentNode()) {
+    // local operation
+    auto nativePtr = static_cast<T*>(Memory::getNativeAddress(ptr.address));
+    auto result = Op::native(nativePtr, value, stdToGccMemOrder(order));
+
+#if PANDO_MEM_TRACE_OR_STAT
+    // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
+    MemTraceLogger::log(Op::memTraceOp, nodeIdx, nodeIdx, sizeof(T), nativePtr, ptr.address);
+#endif
+
+    return result;
+  } else {
+    // remote operation
+
+    // 1. fence to guarantee ordering at the caller
+    preAtomicOpFence(order);
+
+    // 2. blocking relaxed atomic operation
+    Nodes::ValueHandle<T> handle;
+    if (auto status = Op::remote(nodeIdx, ptr.address, value, handle);
+        status != Status::Success) {
+      SPDLOG_ERROR("Remote operation error: {}", status);
+      PANDO_ABORT("Remote operation error");
+    }
+    hartYieldUntil([&handle] {
+      return handle.ready();
+    });
+
+    // 3. fence to guarantee ordering at the caller
+    postAtomicOpFence(order);
+
+    return handle.value();
+  }
+
+#else
+
+#if defined(PANDO_RT_BYPASS)
+  if (getBypassFlag()) {
+    T* as_native_pointer = static_cast<T*>(detail::translateToNative(ptr.address));
+    auto result = Op::native(as_native_pointer, value, static_cast<int>(std::memory_order_relaxed));
+    hartYield(1);
+    return result;
+  } else {
+    return Op::simulated(ptr.address, value);
+  }
+#else
+  return Op::simulated(ptr.address, value);
+#endif
+
+#endif
+}
+
+#define INSTANTIATE_ATOMIC_FETCH_OPS(T)                                  \
+  T atomicFetchMin(GlobalPtr<T> ptr, T value, std::memory_order order) { \
+    return atomicFetchOpImpl<FetchMinOp>(ptr, value, order);             \
+  }                                                                      \
+  T atomicFetchMax(GlobalPtr<T> ptr, T value, std::memory_order order) { \
+    return atomicFetchOpImpl<FetchMaxOp>(ptr, value, order);             \
+  }                                                                      \
+  T atomicFetchOr(GlobalPtr<T> ptr, T value, std::memory_order order) {  \
+    return atomicFetchOpImpl<FetchOrOp>(ptr, value, order);              \
+  }                                                                      \
+  T atomicFetchAnd(GlobalPtr<T> ptr, T value, std::memory_order order) { \
+    return atomicFetchOpImpl<FetchAndOp>(ptr, value, order);             \
+  }
+
+INSTANTIATE_ATOMIC_FETCH_OPS(std::int32_t)
+INSTANTIATE_ATOMIC_FETCH_OPS(std::int64_t)
+INSTANTIATE_ATOMIC_FETCH_OPS(std::uint32_t)
+INSTANTIATE_ATOMIC_FETCH_OPS(std::uint64_t)
+
+#undef INSTANTIATE_ATOMIC_FETCH_OPS
+
 void atomicThreadFence([[maybe_unused]] std::memory_order order) {
 #ifdef PANDO_RT_USE_BACKEND_PREP
 
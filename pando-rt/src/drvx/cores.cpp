@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <functional>
 #include <limits>
+#include <random>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -20,6 +21,8 @@
 #include "drvx.hpp"
 #include "index.hpp"
 #include "log.hpp"
+#include "pando-rt/execution/execute_on_impl.hpp"
+#include "pando-rt/execution/termination.hpp"
 #include "status.hpp"
 
 namespace pando {
@@ -36,6 +39,29 @@ constexpr auto operator+(CoreState e) noexcept {
 // Per-core (L1SP) variables
 Drvx::StaticL1SP<Cores::TaskQueue*> coreQueue;
 
+// Per-pod (L2SP) pools of tasks that may execute on any pod of the node, or on any node
+Drvx::StaticL2SP<Cores::TaskQueue*> anyPodPool;
+Drvx::StaticL2SP<Cores::TaskQueue*> anyNodePool;
+
+// Per-pod (L2SP) number of harts that are accessing the pools of the pod
+Drvx::StaticL2SP<std::int64_t> poolUsers;
+
+// Returns the pool of the pod in place; it is nullptr once the pod closed its pools
+Cores::TaskQueue* getPoolQueue(Place place, bool anyNodeTasks) noexcept {
+  return anyNodeTasks ? *toNativeDrvPtr(anyNodePool, place) : *toNativeDrvPtr(anyPodPool, place);
+}
+
+// Calls f with the pool of the pod in place, or nullptr if it is closed. The pod does not delete
+// its pools while f runs; see Cores::finalizeQueues.
+template <typename F>
+decltype(auto) withPool(Place place, bool anyNodeTasks, F&& f) {
+  const auto users = toNativeDrvPtr(poolUsers, place);
+  DrvAPI::atomic_add<std::int64_t>(users, 1);
+  auto result = f(getPoolQueue(place, anyNodeTasks));
+  DrvAPI::atomic_add<std::int64_t>(users, -1);
+  return result;
+}
+
 } // namespace
 
 void Cores::initializeQueues() {
@@ -45,6 +71,12 @@ void Cores::initializeQueues() {
     // initialize core object
     coreQueue = new TaskQueue;
 
+    // the first core of the pod also initializes the pools of the pod
+    if (Drvx::getCurrentCore().x == 0) {
+      anyPodPool = new TaskQueue;
+      anyNodePool = new TaskQueue;
+    }
+
     // indicate that core initialization is complete and state is ready
     DrvAPI::setCoreState(Drvx::getCurrentNode().id, Drvx::getCurrentPod().x, Drvx::getCurrentCore().x, +CoreState::Ready);
 
@@ -80,6 +112,21 @@ void Cores::finalizeQueues() {
 
     TaskQueue* queue = coreQueue;
     delete queue;
+
+    if (Drvx::getCurrentCore().x == 0) {
+      // close the pools, then wait for harts of other pods that may still be accessing them;
+      // a hart registers in poolUsers before it reads a pool, so once the pools are closed and
+      // there are no users, no hart can reach them anymore
+      TaskQueue* podPool = anyPodPool;
+      TaskQueue* nodePool = anyNodePool;
+      anyPodPool = nullptr;
+      anyNodePool = nullptr;
+      while (poolUsers != 0) {
+        hartYield(1000);
+      }
+      delete podPool;
+      delete nodePool;
+    }
   }
 
   // Other harts simply exit
@@ -105,20 +152,80 @@ Cores::TaskQueue* Cores::getTaskQueue(Place place) noexcept {
   return *toNativeDrvPtr(coreQueue, place);
 }
 
+Status Cores::enqueuePooled(Place place, bool anyNodeTasks, Task& task) {
+  return withPool(place, anyNodeTasks, [&task](TaskQueue* pool) {
+    return (pool != nullptr) ? pool->enqueue(std::move(task)) : Status::NotInit;
+  });
+}
+
+std::optional<Task> Cores::tryDequeuePooled(Place place, bool anyNodeTasks) {
+  return withPool(place, anyNodeTasks, [](TaskQueue* pool) {
+    return (pool != nullptr) ? pool->tryDequeue() : std::optional<Task>{};
+  });
+}
+
 void Cores::finalize() {
 }
 
 void Cores::workStealing(std::optional<pando::Task>& task) {
   const auto thisPlace = getCurrentPlace();
   const auto coreDims = getCoreDims();
-
-  // onyl steal from the neighbor core
-  for(std::int8_t i = thisPlace.core.x + 1; i < thisPlace.core.x + 2; i++) {
-    auto* otherQueue =  pando::Cores::getTaskQueue(pando::Place{thisPlace.node, thisPlace.pod, pando::CoreIndex(i % coreDims.x, 0)});
-    if(otherQueue->getApproxSize() > STEAL_THRESH_HOLD_SIZE) {
+  const auto podDims = getPodDims();
+  const auto nodeDims = getNodeDims();
+  auto& rng = perCoreRNG.getLocal();
+
+  // tries to steal a task from the queue of the core in place
+  auto trySteal = [&task](Place place) {
+    auto* otherQueue = pando::Cores::getTaskQueue(place);
+    if (otherQueue->getApproxSize() > STEAL_THRESH_HOLD_SIZE) {
       task = otherQueue->tryDequeue();
     }
+    return task.has_value();
+  };
+
+  // steal from the neighbor core first, then from a random core of the pod
+  const CoreIndex neighborCore((thisPlace.core.x + 1) % coreDims.x, 0);
+  if (trySteal(Place{thisPlace.node, thisPlace.pod, neighborCore}) ||
+      trySteal(Place{thisPlace.node, thisPlace.pod, CoreIndex(perCoreDist.getLocal()(rng), 0)})) {
+    return;
+  }
+
+  // Tasks placed on a core or pod never leave it: they may use the memory of their place. Only
+  // tasks that were spawned on anyPod or anyNode are pooled and may move to another pod or node.
+  auto tryTakePooled = [&task](Place place, bool anyNodeTasks) {
+    task = pando::Cores::tryDequeuePooled(place, anyNodeTasks);
+    return task.has_value();
+  };
+
+  // then take a pooled task of this pod
+  if (tryTakePooled(thisPlace, false) || tryTakePooled(thisPlace, true)) {
+    return;
+  }
+
+  // Once all CPs finalized, no new tasks are pooled and the pools of other pods are being closed,
+  // so there is nothing left to take from them.
+  if (DrvAPI::getGlobalCpsFinalized() == nodeDims.id) {
+    return;
+  }
+
+  // then from the pools of a random pod of this node, and finally from the anyNode pool of a
+  // random pod of a random node
+  Place victim{thisPlace.node,
+               PodIndex(std::uniform_int_distribution<std::int8_t>(0, podDims.x - 1)(rng), 0),
+               CoreIndex(0, 0)};
+  if (victim.pod == thisPlace.pod ||
+      !(tryTakePooled(victim, false) || tryTakePooled(victim, true))) {
+    victim.node = NodeIndex(std::uniform_int_distribution<std::int64_t>(0, nodeDims.id - 1)(rng));
+    victim.pod = PodIndex(std::uniform_int_distribution<std::int8_t>(0, podDims.x - 1)(rng), 0);
+    if (victim.node == thisPlace.node || !tryTakePooled(victim, true)) {
+      return;
+    }
   }
+
+  // Pooled tasks are counted by the pod of their pool for termination detection; the task now
+  // finishes in this pod.
+  TerminationDetection::increaseTasksCreated(thisPlace, 1);
+  TerminationDetection::increaseTasksCreated(victim, -1);
 }
 
 } // namespace pando
@@ -5,6 +5,7 @@
 #define PANDO_RT_SRC_DRVX_CORES_HPP_
 
 #include <cstddef>
+#include <optional>
 #include <tuple>
 
 #include "../start.hpp"
@@ -51,6 +52,22 @@ public:
    */
   [[nodiscard]] static TaskQueue* getTaskQueue(Place place) noexcept;
 
+  /**
+   * @brief Enqueues @p task in the pool of the pod in @p place of the tasks that may execute on any
+   *        pod of its node or, if @p anyNodeTasks is `true`, on any node.
+   *
+   * @return @ref Status::NotInit and leaves @p task untouched if the pool is not initialized or
+   *         already finalized
+   */
+  [[nodiscard]] static Status enqueuePooled(Place place, bool anyNodeTasks, Task& task);
+
+  /**
+   * @brief Takes a task from the pool of the pod in @p place, if the pool exists and has one.
+   *
+   * @see enqueuePooled
+   */
+  [[nodiscard]] static std::optional<Task> tryDequeuePooled(Place place, bool anyNodeTasks);
+
   /**
    * @brief Returns a flag to check if the core is active.
    */
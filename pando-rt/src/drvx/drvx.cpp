@@ -4,14 +4,12 @@
 
 #include "drvx.hpp"
 
+#include "pando-rt/memory/translation_cache.hpp"
+
 namespace pando {
 
 void* DrvAPIAddressToNative(DrvAPI::DrvAPIAddress addr) {
-  size_t _blah = 0;
-  //ignored
-  void* ret = nullptr;
-  DrvAPI::DrvAPIAddressToNative(addr, &ret, &_blah);
-  return ret;
+  return detail::translateToNative(addr);
 }
 
 // Yields to the next hart
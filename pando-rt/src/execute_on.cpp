@@ -59,4 +59,36 @@ Status detail::executeOn(Place place, Task task) {
 #endif // PANDO_RT_USE_BACKEND_PREP || PANDO_RT_USE_BACKEND_DRVX
 }
 
+#if defined(PANDO_RT_USE_BACKEND_DRVX)
+
+Status detail::executeOnAnyPod(Place place, Task task) {
+  const bool anyNodeTask = (place.node == anyNode);
+  if (anyNodeTask) {
+    place.node = getCurrentNode();
+  }
+
+  // check if node index is within bounds
+  const auto& nodeDims = getNodeDims();
+  if ((place.node < NodeIndex{0}) || (place.node >= nodeDims)) {
+    PANDO_ABORT("Invalid node index");
+  }
+
+  place.pod = (place.node == getCurrentNode() && !isOnCP()) ? getCurrentPod() : PodIndex{0, 0};
+  place.core = CoreIndex{0, 0};
+
+  // the pod of the pool counts its tasks until a hart takes them
+  TerminationDetection::increaseTasksCreated(place, 1);
+  if (const auto status = Cores::enqueuePooled(place, anyNodeTask, task);
+      status != Status::NotInit) {
+    return status;
+  }
+
+  // the pool is already finalized; place the task on the pod instead
+  TerminationDetection::increaseTasksCreated(place, -1);
+  place.core = anyCore;
+  return executeOn(place, std::move(task));
+}
+
+#endif // PANDO_RT_USE_BACKEND_DRVX
+
 } // namespace pando
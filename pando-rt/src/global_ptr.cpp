@@ -4,12 +4,14 @@
 
 #include "pando-rt/memory/global_ptr.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 #include <type_traits>
 
 #include "pando-rt/locality.hpp"
 #include "pando-rt/memory/address_translation.hpp"
+#include "pando-rt/memory/translation_cache.hpp"
 #include "pando-rt/stdlib.hpp"
 #include "pando-rt/benchmark/counters.hpp"
 
@@ -41,6 +43,10 @@ GlobalAddress createGlobalAddress(void* nativePtr) noexcept {
     return GlobalAddress{};
   }
 
+  if (auto addr = localMainToGlobal(nativePtr); addr != GlobalAddress{}) {
+    return addr;
+  }
+
   const auto thisPlace = getCurrentPlace();
 
   // check if it is in L2SP or main memory
@@ -90,6 +96,10 @@ void* asNativePtr(GlobalAddress globalAddr) noexcept {
     return nullptr;
   }
 
+  if (auto nativePtr = localToNative(globalAddr); nativePtr != nullptr) {
+    return nativePtr;
+  }
+
   const auto nodeIdx = extractNodeIndex(globalAddr);
   if (nodeIdx != Nodes::getCurrentNode()) {
     // object is not in this host
@@ -104,10 +114,7 @@ void* asNativePtr(GlobalAddress globalAddr) noexcept {
     // object is not in this host
     PANDO_ABORT("Object is in remote native address");
   }
-  void* nativePtr{nullptr};
-  std::size_t size = 0;
-  DrvAPI::DrvAPIAddressToNative(globalAddr, &nativePtr, &size);
-  return nativePtr;
+  return translateToNative(globalAddr);
 
 #else
 
@@ -130,13 +137,16 @@ void load(GlobalAddress srcGlobalAddr, std::size_t n, void* dstNativePtr) {
     // yield to other hart and then issue the operation
     //hartYield();
 
-    const void* srcNativePtr = Memory::getNativeAddress(srcGlobalAddr);
+    const void* srcNativePtr = localToNative(srcGlobalAddr);
+    if (srcNativePtr == nullptr) {
+      srcNativePtr = Memory::getNativeAddress(srcGlobalAddr);
+    }
     // we read from shared memory
     std::memcpy(dstNativePtr, srcNativePtr, n);
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("LOAD", nodeIdx, nodeIdx, n, dstNativePtr, srcGlobalAddr);
+    MemTraceLogger::log(MemTraceOp::Load, nodeIdx, nodeIdx, n, dstNativePtr, srcGlobalAddr);
 #endif
     counter::recordHighResolutionEvent(pointerCount, pointerTimer);
   } else {
@@ -156,8 +166,13 @@ void load(GlobalAddress srcGlobalAddr, std::size_t n, void* dstNativePtr) {
 
 #if defined(PANDO_RT_BYPASS)
   if (getBypassFlag()) {
-    auto srcNativePtr = pando::DrvAPIAddressToNative(srcGlobalAddr);
-    std::memcpy(dstNativePtr, srcNativePtr, n);
+    // copy one contiguous native range at a time
+    auto byteDst = static_cast<std::byte*>(dstNativePtr);
+    for (std::size_t size = 0; n > 0; n -= size, byteDst += size, srcGlobalAddr += size) {
+      auto srcNativePtr = translateRangeToNative(srcGlobalAddr, size);
+      size = std::min(size, n);
+      std::memcpy(byteDst, srcNativePtr, size);
+    }
     DrvAPI::nop(1u);
   } else {
 #else
@@ -203,13 +218,16 @@ void store(GlobalAddress dstGlobalAddr, std::size_t n, const void* srcNativePtr)
     // yield to other hart and then issue the operation
     //hartYield();
 
-    void* dstNativePtr = Memory::getNativeAddress(dstGlobalAddr);
+    void* dstNativePtr = localToNative(dstGlobalAddr);
+    if (dstNativePtr == nullptr) {
+      dstNativePtr = Memory::getNativeAddress(dstGlobalAddr);
+    }
     std::memcpy(dstNativePtr, srcNativePtr, n);
     // we write to shared memory
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("STORE", nodeIdx, nodeIdx, n, dstNativePtr, dstGlobalAddr);
+    MemTraceLogger::log(MemTraceOp::Store, nodeIdx, nodeIdx, n, dstNativePtr, dstGlobalAddr);
 #endif
     counter::recordHighResolutionEvent(pointerCount, pointerTimer);
   } else {
@@ -229,40 +247,15 @@ void store(GlobalAddress dstGlobalAddr, std::size_t n, const void* srcNativePtr)
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 
 #if defined(PANDO_RT_BYPASS)
-  using BlockType = std::uint64_t;
-  const auto blockSize = sizeof(BlockType);
-  const auto numBlocks = n / blockSize;
-  const auto remainderBytes = n % blockSize;
-
-  auto blockSrc = static_cast<const BlockType*>(srcNativePtr);
-  auto blockDst = reinterpret_cast<std::uint64_t>(dstGlobalAddr);
-
-  const auto bytesWritten = numBlocks * blockSize;
-  auto byteSrc = static_cast<const std::byte*>(srcNativePtr) + bytesWritten;
-  auto byteDst = reinterpret_cast<std::uint64_t>(dstGlobalAddr) + bytesWritten;
   if (getBypassFlag()) {
-    for (std::size_t i = 0; i < numBlocks; i++) {
-      auto blockData = *(blockSrc + i);
-      const auto offset = i * blockSize;
-
-      void *addr_native = nullptr;
-      std::size_t size = 0;
-      DrvAPI::DrvAPIAddressToNative(blockDst + offset, &addr_native, &size);
-      BlockType* as_native_pointer = reinterpret_cast<BlockType*>(addr_native);
-      *as_native_pointer = blockData;
-      hartYield(1);
-    }
-
-    for (std::size_t i = 0; i < remainderBytes; i++) {
-      auto byteData = *(byteSrc + i);
-
-      void *addr_native = nullptr;
-      std::size_t size = 0;
-      DrvAPI::DrvAPIAddressToNative(byteDst + i, &addr_native, &size);
-      std::byte* as_native_pointer = reinterpret_cast<std::byte*>(addr_native);
-      *as_native_pointer = byteData;
-      hartYield(1);
+    // copy one contiguous native range at a time
+    auto byteSrc = static_cast<const std::byte*>(srcNativePtr);
+    for (std::size_t size = 0; n > 0; n -= size, byteSrc += size, dstGlobalAddr += size) {
+      auto dstNativePtr = translateRangeToNative(dstGlobalAddr, size);
+      size = std::min(size, n);
+      std::memcpy(dstNativePtr, byteSrc, size);
     }
+    DrvAPI::nop(1u);
   } else {
 #else
   {
@@ -312,7 +305,7 @@ void bulkMemcpy(GlobalAddress srcGlobalAddr, std::size_t n, GlobalAddress dstGlo
 
 #if PANDO_MEM_TRACE_OR_STAT
     // if the level of mem-tracing is ALL (2), log intra-pxn memory operations
-    MemTraceLogger::log("DMA", nodeIdxSrc, nodeIdxDst, n, srcNativePtr, srcGlobalAddr);
+    MemTraceLogger::log(MemTraceOp::DMA, nodeIdxSrc, nodeIdxDst, n, srcNativePtr, srcGlobalAddr);
 #endif
     counter::recordHighResolutionEvent(pointerCount, pointerTimer);
   } else if(nodeIdxSrc == Nodes::getCurrentNode()) {
@@ -320,7 +313,7 @@ void bulkMemcpy(GlobalAddress srcGlobalAddr, std::size_t n, GlobalAddress dstGlo
     Nodes::AckHandle handle;
     void* srcNativePtr = Memory::getNativeAddress(srcGlobalAddr);
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("DMA", nodeIdxSrc, nodeIdxDst, n, srcNativePtr, srcGlobalAddr);
+    MemTraceLogger::log(MemTraceOp::DMA, nodeIdxSrc, nodeIdxDst, n, srcNativePtr, srcGlobalAddr);
 #endif
     if (auto status = Nodes::store(nodeIdxDst, dstGlobalAddr, n, srcNativePtr, handle);
         status != Status::Success) {
@@ -341,7 +334,7 @@ void bulkMemcpy(GlobalAddress srcGlobalAddr, std::size_t n, GlobalAddress dstGlo
     }
 #if PANDO_MEM_TRACE_OR_STAT
     void *srcNativePtr = Memory::getNativeAddress(srcGlobalAddr);
-    MemTraceLogger::log("STORE", nodeIdxSrc, nodeIdxSrc, n, srcNativePtr, srcGlobalAddr);
+    MemTraceLogger::log(MemTraceOp::Store, nodeIdxSrc, nodeIdxSrc, n, srcNativePtr, srcGlobalAddr);
 #endif
 
     hartYieldUntil([&handle] {
@@ -26,6 +26,9 @@
 #ifdef PANDO_RT_ENABLE_MEM_STAT
 #include "prep/memtrace_stat.hpp"
 #endif
+#ifdef PANDO_RT_TRACE_MEM_PREP
+#include "prep/memtrace_log.hpp"
+#endif
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 #include "drvx/cores.hpp"
 #include "drvx/cp.hpp"
@@ -120,6 +123,13 @@ namespace {
   }
 #endif
 
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  if (auto status = MemTraceLogger::initialize(Nodes::getCurrentNode());
+      status != Status::Success) {
+    return status;
+  }
+#endif
+
   // initializes memory and zeroes the first bytes that are required for global variables
   if (auto status = Memory::initialize(getReservedMemorySpace(MemoryType::L2SP),
                                        getReservedMemorySpace(MemoryType::Main));
@@ -142,6 +152,10 @@ void powerOff() {
   Memory::finalize();
   Nodes::finalize();
 
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceLogger::finalize();
+#endif
+
 #ifdef PANDO_RT_ENABLE_MEM_STAT
   MemTraceStat::finalize();
 #endif
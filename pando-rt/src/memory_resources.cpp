@@ -5,6 +5,7 @@
 #include "memory_resources.hpp"
 
 #include <algorithm>
+#include <limits>
 
 #include "pando-rt/locality.hpp"
 #include "pando-rt/memory.hpp"
@@ -57,11 +58,12 @@ void alignStartAndRound(MemoryBucket& slabBucket, const MemoryBucket& previousBu
  * bucket.
  * @param bufferStart The start of the entire memory region buffer.
  * @param bufferSize The size of the entire memory region buffer.
+ * @param numCaches The number of caches of the free list resource.
  */
 void initializeFreeListResourceBucket(MemoryBucket& freeList, const MemoryBucket& previousBucket,
                                       GlobalPtr<const std::byte> bufferStart,
-                                      const std::size_t bufferSize) {
-  freeList.bytes = FreeListMemoryResource::computeMetadataSize();
+                                      const std::size_t bufferSize, const std::size_t numCaches) {
+  freeList.bytes = FreeListMemoryResource::computeMetadataSize(numCaches);
   freeList.ratio = static_cast<double>(freeList.bytes) / static_cast<double>(bufferSize);
   freeList.start = previousBucket.start + previousBucket.bytes;
   const auto freeListMinimumAlignment = alignof(MaxAlignT);
@@ -104,6 +106,53 @@ void initializeBumpResourceBucket(MemoryBucket& bump, const MemoryBucket& previo
   bump.ratio = static_cast<double>(bump.bytes) / static_cast<double>(bufferSize);
 }
 
+/// @brief Cache index of a thread of execution that has no free-list cache.
+constexpr std::size_t noCache = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Returns the number of harts in a PXN.
+ */
+std::size_t getNumHartsPerNode() noexcept {
+  const auto placeDims = getPlaceDims();
+  const auto threadDims = getThreadDims();
+  return static_cast<std::size_t>(placeDims.pod.x) * placeDims.pod.y * placeDims.core.x *
+         placeDims.core.y * threadDims.id;
+}
+
+/**
+ * @brief Returns the free-list cache of the current hart or @ref noCache if it has none.
+ *
+ * @param numCaches The number of caches of the free-list resource.
+ */
+std::size_t currentCacheIndex(std::size_t numCaches) noexcept {
+  if (numCaches == 0 || isOnCP()) {
+    return noCache;
+  }
+  const auto placeDims = getPlaceDims();
+  const auto threadDims = getThreadDims();
+  const auto pod = getCurrentPod();
+  const auto core = getCurrentCore();
+  const std::size_t podIndex = static_cast<std::size_t>(pod.x) * placeDims.pod.y + pod.y;
+  const std::size_t coreIndex =
+      (podIndex * placeDims.core.x + core.x) * static_cast<std::size_t>(placeDims.core.y) + core.y;
+  const std::size_t hartIndex = coreIndex * threadDims.id + getCurrentThread().id;
+  return (hartIndex < numCaches) ? hartIndex : noCache;
+}
+
+/**
+ * @brief Returns the number of bytes that the bump resource allocates for a request of @p bytes.
+ *
+ * Any bump resource allocation is at least `FreeListMemoryResource::minimumAllowableAllocationSize`
+ * bytes so that it can be registered with the free-list resource. Sizes that the free-list
+ * caches hold are rounded up to the next cacheable size, a multiple of a quarter of their
+ * power-of-two size class, so that freed blocks can be reused by any request that rounds to the
+ * same size while wasting less than 25% of the allocation.
+ */
+constexpr std::size_t roundedBumpAllocation(std::size_t bytes) noexcept {
+  return FreeListMemoryResource::roundToCacheableSize(
+      std::max(bytes, FreeListMemoryResource::minimumAllowableAllocationSize()));
+}
+
 template <typename T>
 [[nodiscard]] GlobalPtr<void> chainedTryAllocate(std::size_t bytes, std::size_t alignment,
                                                  T* allocator) {
@@ -153,14 +202,15 @@ L2SPResourceRatioBreakdown::L2SPResourceRatioBreakdown(GlobalPtr<std::byte> buff
                                                                bufferSize);
 
   // Free list alignment and computation
-  initializeFreeListResourceBucket(freeList, bucket32, bufferStart, bufferSize);
+  initializeFreeListResourceBucket(freeList, bucket32, bufferStart, bufferSize, 0);
 
   // Bump alignment and computation
   initializeBumpResourceBucket(bump, freeList, bufferStart, bufferSize);
 }
 
 MainMemoryResourceRatioBreakdown::MainMemoryResourceRatioBreakdown(GlobalPtr<std::byte> bufferStart,
-                                                                   std::size_t bufferSize)
+                                                                   std::size_t bufferSize,
+                                                                   std::size_t numCaches)
     : bucket8{0.006f, 0, nullptr},
       bucket16{0.006f, 0, nullptr},
       bucket32{0.006f, 0, nullptr},
@@ -181,7 +231,7 @@ MainMemoryResourceRatioBreakdown::MainMemoryResourceRatioBreakdown(GlobalPtr<std
                                                                 bufferSize);
 
   // Free list alignment and computation
-  initializeFreeListResourceBucket(freeList, bucket128, bufferStart, bufferSize);
+  initializeFreeListResourceBucket(freeList, bucket128, bufferStart, bufferSize, numCaches);
 
   // Bump alignment and computation
   initializeBumpResourceBucket(bump, freeList, bufferStart, bufferSize);
@@ -244,14 +294,15 @@ bool L2SPResource::operator!=(const L2SPResource& rhs) const noexcept {
   return !(*this == rhs);
 }
 
-MainMemoryResource::MainMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize)
-    : m_breakdown(bufferStart, bufferSize),
+MainMemoryResource::MainMemoryResource(GlobalPtr<std::byte> bufferStart, std::size_t bufferSize,
+                                       std::size_t numCaches)
+    : m_breakdown(bufferStart, bufferSize, numCaches),
       m_bucket8(m_breakdown.bucket8.start, m_breakdown.bucket8.bytes),
       m_bucket16(m_breakdown.bucket16.start, m_breakdown.bucket16.bytes),
       m_bucket32(m_breakdown.bucket32.start, m_breakdown.bucket32.bytes),
       m_bucket64(m_breakdown.bucket64.start, m_breakdown.bucket64.bytes),
       m_bucket128(m_breakdown.bucket128.start, m_breakdown.bucket128.bytes),
-      m_freeList(m_breakdown.freeList.start, m_breakdown.freeList.bytes),
+      m_freeList(m_breakdown.freeList.start, m_breakdown.freeList.bytes, numCaches),
       m_bump(m_breakdown.bump.start, m_breakdown.bump.bytes) {}
 
 GlobalPtr<void> MainMemoryResource::allocate(std::size_t bytes, std::size_t alignment) {
@@ -271,13 +322,26 @@ GlobalPtr<void> MainMemoryResource::allocate(std::size_t bytes, std::size_t alig
   }
 
   if (result == nullptr) {
-    auto roundedAllocation = std::max(bytes, minimumBumpAllocation);
+    auto roundedAllocation = roundedBumpAllocation(bytes);
+    // try allocating from the cache of the hart; it does not need any locking
+    if (const auto cacheIndex = currentCacheIndex(m_freeList.getNumCaches());
+        (cacheIndex != noCache) && FreeListMemoryResource::isCacheableSize(roundedAllocation)) {
+      result = m_freeList.allocateCached(cacheIndex, roundedAllocation);
+      if (result != nullptr) {
+        return result;
+      }
+    }
     // try allocating from the bump resource
     result = m_bump.allocate(roundedAllocation);
     if (result == nullptr) {
       // try allocating from the free-list resource
       result = m_freeList.allocate(roundedAllocation);
     }
+    if ((result == nullptr) && (m_freeList.flushCaches() > 0)) {
+      // blocks held by the caches of any hart, including this one, are returned to the free-list
+      // resource before failing
+      result = m_freeList.allocate(roundedAllocation);
+    }
   }
   return result;
 }
@@ -297,11 +361,15 @@ void MainMemoryResource::deallocate(GlobalPtr<void> p, std::size_t bytes, std::s
   }
 
   if (m_bump.pointerIsOwned(p)) {
-    // any bump resource allocation is at least minimumBumpAllocation bytes
-    auto roundedAllocation = std::max(bytes, minimumBumpAllocation);
+    auto roundedAllocation = roundedBumpAllocation(bytes);
     // the bump resource does not support deallocation but
     // the free-list resource can manage freed memory blocks from the bump resource.
-    m_freeList.registerFreedBlock(p, roundedAllocation);
+    if (const auto cacheIndex = currentCacheIndex(m_freeList.getNumCaches());
+        (cacheIndex != noCache) && FreeListMemoryResource::isCacheableSize(roundedAllocation)) {
+      m_freeList.deallocateCached(cacheIndex, p, roundedAllocation);
+    } else {
+      m_freeList.registerFreedBlock(p, roundedAllocation);
+    }
   }
 }
 
@@ -334,7 +402,7 @@ void initMemoryResources() {
   } else if (isOnCP()) {
     // construct main memory resource for the PXN by its CP
     auto [baseAddress, byteCount] = detail::getMemoryStartAndSize(MemoryType::Main);
-    mainMemoryResource = new MainMemoryResource(baseAddress, byteCount);
+    mainMemoryResource = new MainMemoryResource(baseAddress, byteCount, getNumHartsPerNode());
   }
 }
 
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
+
+#ifndef PANDO_RT_SRC_NATIVE_ATOMIC_HPP_
+#define PANDO_RT_SRC_NATIVE_ATOMIC_HPP_
+
+namespace pando {
+
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the minimum of it and @p value
+ *        and returns the previous value held.
+ *
+ * @note The GCC builtins have no fetch-min, so this is a compare-exchange loop on native memory
+ *       that only writes if @p value is smaller.
+ *
+ * @ingroup ROOT
+ */
+template <typename T>
+T nativeAtomicFetchMin(T* ptr, T value, int memOrder) noexcept {
+  constexpr bool weak = true;
+  T expected = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+  while (value < expected && !__atomic_compare_exchange_n(ptr, &expected, value, weak, memOrder,
+                                                          __ATOMIC_RELAXED)) {
+  }
+  return expected;
+}
+
+/**
+ * @brief Atomically replaces the value pointed to by @p ptr with the maximum of it and @p value
+ *        and returns the previous value held.
+ *
+ * @note This is a compare-exchange loop that only writes if @p value is larger.
+ *
+ * @ingroup ROOT
+ */
+template <typename T>
+T nativeAtomicFetchMax(T* ptr, T value, int memOrder) noexcept {
+  constexpr bool weak = true;
+  T expected = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+  while (expected < value && !__atomic_compare_exchange_n(ptr, &expected, value, weak, memOrder,
+                                                          __ATOMIC_RELAXED)) {
+  }
+  return expected;
+}
+
+} // namespace pando
+
+#endif // PANDO_RT_SRC_NATIVE_ATOMIC_HPP_
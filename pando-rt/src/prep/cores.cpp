@@ -20,7 +20,9 @@
 #include "config.hpp"
 #include "hart_context.hpp"
 #include "index.hpp"
+#include "load_balancer.hpp"
 #include "log.hpp"
+#include "pando-rt/execution/execute_on_impl.hpp"
 #include "status.hpp"
 
 #include <pando-rt/benchmark/counters.hpp>
@@ -468,13 +470,25 @@ void Cores::workStealing(std::optional<pando::Task>& task, SchedulerFailState& f
       break;
 
     case SchedulerFailState::STEAL:
-      // only steal work from the neighbor core
-      for(std::int8_t i = thisPlace.core.x + 1; i < thisPlace.core.x + 2; i++) {
-        auto* otherQueue =  pando::Cores::getTaskQueue(pando::Place{thisPlace.node, thisPlace.pod, pando::CoreIndex(i % coreDims.x, 0)});
-        if(otherQueue->getApproxSize() > STEAL_THRESH_HOLD_SIZE) {
+      // steal work from the neighbor core first, then from a random core of the pod; PREP models
+      // a single pod per node, so there are no other pods to steal from
+      for (auto coreIdx : {static_cast<std::int8_t>((thisPlace.core.x + 1) % coreDims.x),
+                           perCoreDist.getLocal()(perCoreRNG.getLocal())}) {
+        auto* otherQueue = pando::Cores::getTaskQueue(
+            pando::Place{thisPlace.node, thisPlace.pod, pando::CoreIndex(coreIdx, 0)});
+        if (otherQueue->getApproxSize() > STEAL_THRESH_HOLD_SIZE) {
           task = otherQueue->tryDequeue();
+          if (task.has_value()) {
+            break;
+          }
         }
       }
+
+      // then schedule a task that may execute on any node from the pool of this node, and
+      // finally ask another node for tasks
+      if (!task.has_value() && !LoadBalancer::tryExecuteLocal()) {
+        LoadBalancer::requestSteal();
+      }
       failState = SchedulerFailState::YIELD;
       break;
   }
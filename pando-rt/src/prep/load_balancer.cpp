@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved. */
+
+#include "load_balancer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "../queue.hpp"
+#include "index.hpp"
+#include "log.hpp"
+#include "nodes.hpp"
+#include "pando-rt/execution/request.hpp"
+#include "pando-rt/execution/termination.hpp"
+#include "pando-rt/locality.hpp"
+#include "pando-rt/stdlib.hpp"
+#include "status.hpp"
+
+namespace pando {
+
+namespace {
+
+// maximum number of requests sent in response to a steal request
+constexpr std::size_t stealBatchSize = 16;
+// maximum size of a response to a steal request
+constexpr std::size_t maxStealResponseSize = 8192;
+// alignment of requests in the pool and in steal responses
+constexpr std::size_t requestAlignment = alignof(std::max_align_t);
+// backoff between steal requests after a failed attempt
+constexpr std::int64_t minStealBackoffNs = 50'000;
+constexpr std::int64_t maxStealBackoffNs = 10'000'000;
+
+constexpr std::size_t alignUp(std::size_t n) noexcept {
+  return (n + requestAlignment - 1) / requestAlignment * requestAlignment;
+}
+
+struct PooledRequest {
+  std::byte* data{};
+  std::size_t size{};
+};
+
+// requests that may execute on any node and have not been scheduled yet
+Queue<PooledRequest> pool;
+// nodes that asked this node for tasks
+Queue<NodeIndex> thieves;
+
+std::atomic<bool> stealInFlight{false};
+std::atomic<std::int64_t> stealBackoffNs{minStealBackoffNs};
+std::atomic<std::int64_t> nextStealAttemptNs{0};
+
+std::int64_t nowNs() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::byte* allocateRequest(std::size_t size) {
+  return static_cast<std::byte*>(::operator new(size, std::align_val_t{requestAlignment}));
+}
+
+void deallocateRequest(std::byte* p) {
+  ::operator delete(p, std::align_val_t{requestAlignment});
+}
+
+// Executes a request that is stored in aligned native memory. The request schedules its task.
+void executeRequest(std::byte* data) {
+  auto* request = reinterpret_cast<detail::Request*>(data);
+  if (auto status = (*request)(); status != Status::Success) {
+    SPDLOG_ERROR("Failed to schedule a pooled task: {}", status);
+    std::abort();
+  }
+}
+
+/**
+ * @brief Request that asks the receiving node for tasks.
+ */
+class StealRequest final : public detail::Request {
+  NodeIndex m_thief;
+
+  [[nodiscard]] static Status impl(detail::Request* base) {
+    auto self = static_cast<StealRequest*>(base);
+    const auto thief = self->m_thief;
+    self->~StealRequest();
+    // handlers cannot send messages, so the request is answered from a hart
+    return thieves.enqueue(thief);
+  }
+
+public:
+  explicit StealRequest(NodeIndex thief) : Request(&impl), m_thief{thief} {}
+};
+
+/**
+ * @brief Response to a @ref StealRequest.
+ *
+ * The response is followed by `count` entries, each made of the request size and the request,
+ * both aligned to `requestAlignment`.
+ */
+class StealResponse final : public detail::Request {
+  std::uint64_t m_count;
+
+  [[nodiscard]] static Status impl(detail::Request* base) {
+    auto self = static_cast<StealResponse*>(base);
+    const auto count = self->m_count;
+    auto p = reinterpret_cast<std::byte*>(self) + headerSize();
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::uint64_t size;
+      std::memcpy(&size, p, sizeof(size));
+      p += alignUp(sizeof(size));
+      // the message buffer may not be aligned for the request
+      auto data = allocateRequest(size);
+      std::memcpy(data, p, size);
+      p += alignUp(size);
+      executeRequest(data);
+      deallocateRequest(data);
+    }
+    self->~StealResponse();
+
+    // the pooled requests were counted as created on the victim; they are now scheduled as tasks
+    TerminationDetection::increaseTasksFinished(count);
+
+    if (count == 0) {
+      const auto backoff = std::min(2 * stealBackoffNs.load(std::memory_order_relaxed),
+                                    maxStealBackoffNs);
+      stealBackoffNs.store(backoff, std::memory_order_relaxed);
+      nextStealAttemptNs.store(nowNs() + backoff, std::memory_order_relaxed);
+    } else {
+      stealBackoffNs.store(minStealBackoffNs, std::memory_order_relaxed);
+    }
+    stealInFlight.store(false, std::memory_order_release);
+    return Status::Success;
+  }
+
+public:
+  explicit StealResponse(std::uint64_t count) : Request(&impl), m_count{count} {}
+
+  static constexpr std::size_t headerSize() noexcept {
+    return alignUp(sizeof(StealResponse));
+  }
+};
+
+} // namespace
+
+void* LoadBalancer::acquire(std::size_t size) {
+  if (getNodeDims().id == 1 || size > maxPooledRequestSize) {
+    return nullptr;
+  }
+  return allocateRequest(size);
+}
+
+void LoadBalancer::release(void* request, std::size_t size) {
+  // count the pooled request as a task, so that termination detection waits for it
+  TerminationDetection::increaseTasksCreated(getCurrentPlace(), 1);
+  if (pool.enqueue(PooledRequest{static_cast<std::byte*>(request), size}) != Status::Success) {
+    PANDO_ABORT("Could not pool task");
+  }
+}
+
+bool LoadBalancer::tryExecuteLocal() {
+  auto pooled = pool.tryDequeue();
+  if (!pooled.has_value()) {
+    return false;
+  }
+  executeRequest(pooled->data);
+  deallocateRequest(pooled->data);
+  TerminationDetection::increaseTasksFinished(1);
+  return true;
+}
+
+void LoadBalancer::requestSteal() {
+  const auto nodeDims = getNodeDims();
+  if (nodeDims.id == 1 || nowNs() < nextStealAttemptNs.load(std::memory_order_relaxed) ||
+      stealInFlight.exchange(true, std::memory_order_acquire)) {
+    return;
+  }
+
+  // pick a random victim other than this node
+  thread_local std::minstd_rand rng(static_cast<std::uint32_t>(nowNs()));
+  const auto thisNode = getCurrentNode();
+  std::uniform_int_distribution<std::int64_t> dist(0, nodeDims.id - 2);
+  auto victim = NodeIndex(dist(rng));
+  if (victim >= thisNode) {
+    victim = NodeIndex(victim.id + 1);
+  }
+
+  detail::RequestBuffer buffer;
+  if (buffer.acquire(victim, sizeof(StealRequest)) != Status::Success) {
+    stealInFlight.store(false, std::memory_order_release);
+    return;
+  }
+  new (buffer.get()) StealRequest(thisNode);
+  buffer.release();
+}
+
+void LoadBalancer::serviceStealRequests() {
+  if (thieves.empty()) {
+    return;
+  }
+  auto thief = thieves.tryDequeue();
+  if (!thief.has_value()) {
+    return;
+  }
+
+  // give away up to half of the pool
+  const auto batchSize =
+      std::min<std::size_t>(stealBatchSize, (pool.getApproxSize() + 1) / 2);
+  std::vector<PooledRequest> batch;
+  std::size_t responseSize = StealResponse::headerSize();
+  while (batch.size() < batchSize) {
+    auto pooled = pool.tryDequeue();
+    if (!pooled.has_value()) {
+      break;
+    }
+    const auto entrySize = alignUp(sizeof(std::uint64_t)) + alignUp(pooled->size);
+    if (!batch.empty() && responseSize + entrySize > maxStealResponseSize) {
+      if (pool.enqueue(*pooled) != Status::Success) {
+        PANDO_ABORT("Could not pool task");
+      }
+      break;
+    }
+    responseSize += entrySize;
+    batch.push_back(*pooled);
+  }
+
+  detail::RequestBuffer buffer;
+  if (auto status = buffer.acquire(*thief, responseSize); status != Status::Success) {
+    SPDLOG_ERROR("Could not send stolen tasks to node {}: {}", *thief, status);
+    std::abort();
+  }
+  auto p = static_cast<std::byte*>(buffer.get());
+  new (p) StealResponse(batch.size());
+  p += StealResponse::headerSize();
+  for (const auto& pooled : batch) {
+    const std::uint64_t size = pooled.size;
+    std::memcpy(p, &size, sizeof(size));
+    p += alignUp(sizeof(size));
+    std::memcpy(p, pooled.data, pooled.size);
+    p += alignUp(pooled.size);
+    deallocateRequest(pooled.data);
+  }
+  buffer.release();
+}
+
+} // namespace pando
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved. */
+
+#ifndef PANDO_RT_SRC_PREP_LOAD_BALANCER_HPP_
+#define PANDO_RT_SRC_PREP_LOAD_BALANCER_HPP_
+
+#include <cstddef>
+
+#include "pando-rt/index.hpp"
+#include "pando-rt/status.hpp"
+
+namespace pando {
+
+/**
+ * @brief Cross-node load balancing of tasks that may execute on any node.
+ *
+ * Tasks created with @ref anyNode are kept serialized in a per-node pool, so that they can still
+ * be moved to another node. Idle harts first take tasks from the pool of their node and otherwise
+ * ask a random node for a batch of tasks. The victim node answers from its scheduler loop with a
+ * single message that carries the batch.
+ *
+ * @ingroup PREP
+ */
+class LoadBalancer {
+public:
+  /// @brief Maximum size in bytes of a request that can be pooled.
+  static constexpr std::size_t maxPooledRequestSize = 2048;
+
+  /**
+   * @brief Allocates @p size bytes to create a request in that may execute on any node.
+   *
+   * @return a pointer to the space or `nullptr` if the request is too large to be pooled
+   */
+  [[nodiscard]] static void* acquire(std::size_t size);
+
+  /**
+   * @brief Adds a request created in space returned by @ref acquire to the pool of this node.
+   */
+  static void release(void* request, std::size_t size);
+
+  /**
+   * @brief Executes one request from the pool of this node, if there is any.
+   *
+   * @return @c true if a request was executed, otherwise @c false
+   */
+  static bool tryExecuteLocal();
+
+  /**
+   * @brief Asks another node for a batch of tasks, unless a request is already in flight or the
+   *        previous attempts failed recently.
+   */
+  static void requestSteal();
+
+  /**
+   * @brief Answers steal requests that this node received.
+   */
+  static void serviceStealRequests();
+};
+
+} // namespace pando
+
+#endif // PANDO_RT_SRC_PREP_LOAD_BALANCER_HPP_
@@ -7,9 +7,11 @@
 #include <memory>
 
 #include "pando-rt/memory/address_translation.hpp"
+#include "pando-rt/memory/translation_cache.hpp"
 
 #include "config.hpp"
 #include "cores.hpp"
+#include "nodes.hpp"
 #include "status.hpp"
 
 namespace pando {
@@ -66,6 +68,9 @@ MemoryChunk main;
 
 } // namespace
 
+detail::LocalMemory detail::localMainMemory;
+detail::LocalMemory detail::localL2SPMemory;
+
 Status Memory::initialize(std::size_t l2SPZeroFillBytes, std::size_t mainZeroFillBytes) {
   const auto& config = Config::getCurrentConfig();
 
@@ -80,11 +85,18 @@ Status Memory::initialize(std::size_t l2SPZeroFillBytes, std::size_t mainZeroFil
       status != Status::Success) {
     return status;
   }
+  const auto thisNode = Nodes::getCurrentNode();
+  detail::localL2SPMemory = {encodeL2SPAddress(thisNode, PodIndex{0, 0}, 0), l2SP.getBaseAddress(),
+                             l2SP.getInformation().byteCount};
+  detail::localMainMemory = {encodeMainAddress(thisNode, 0), main.getBaseAddress(),
+                             main.getInformation().byteCount};
 
   return Status::Success;
 }
 
 void Memory::finalize() {
+  detail::localL2SPMemory = {};
+  detail::localMainMemory = {};
   l2SP.reset();
   main.reset();
 }
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
+
+#include "memtrace_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "log.hpp"
+#include "pando-rt/memory/address_translation.hpp"
+
+namespace pando {
+
+namespace {
+
+constexpr std::uint32_t formatVersion = 2;
+constexpr std::uint8_t noMemoryType = 0xff;
+
+constexpr std::size_t numOps = static_cast<std::size_t>(MemTraceOp::Count);
+constexpr std::size_t numMessages = static_cast<std::size_t>(MemTraceMessage::Count);
+
+// ops of the records: operations, then requests of operations, then messages
+constexpr std::size_t firstRequestOp = numOps;
+constexpr std::size_t firstMessageOp = firstRequestOp + numOps;
+constexpr std::size_t numRecordOps = firstMessageOp + numMessages;
+
+static_assert(numRecordOps <= 0xff);
+
+// number of records of a ring buffer; must be a power of 2
+constexpr std::uint64_t ringCapacity = 1 << 16;
+
+/**
+ * @brief Single-producer single-consumer ring buffer of trace records.
+ */
+struct MemTraceRing {
+  std::unique_ptr<MemTraceRecord[]> records = std::make_unique<MemTraceRecord[]>(ringCapacity);
+  alignas(64) std::atomic<std::uint64_t> head{0};
+  alignas(64) std::atomic<std::uint64_t> tail{0};
+};
+
+std::atomic<bool> isActive{false};
+std::atomic<bool> stopDraining{false};
+std::ofstream traceFile;
+std::thread drainer;
+std::chrono::steady_clock::time_point startTime;
+
+std::mutex ringsMutex;
+std::vector<std::unique_ptr<MemTraceRing>> rings;
+thread_local MemTraceRing* threadRing = nullptr;
+
+MemTraceRing* registerThreadRing() {
+  auto ring = std::make_unique<MemTraceRing>();
+  auto ptr = ring.get();
+  std::lock_guard<std::mutex> lock(ringsMutex);
+  rings.push_back(std::move(ring));
+  return ptr;
+}
+
+// Writes the records of all ring buffers to the trace file. Returns the number of records written.
+std::uint64_t drainRings() {
+  std::vector<MemTraceRing*> snapshot;
+  {
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    snapshot.reserve(rings.size());
+    for (auto& ring : rings) {
+      snapshot.push_back(ring.get());
+    }
+  }
+
+  std::uint64_t numWritten = 0;
+  for (auto ring : snapshot) {
+    const auto tail = ring->tail.load(std::memory_order_relaxed);
+    const auto head = ring->head.load(std::memory_order_acquire);
+    if (head == tail) {
+      continue;
+    }
+    // the records may wrap around the end of the buffer
+    const auto first = tail % ringCapacity;
+    const auto count = head - tail;
+    const auto firstCount = std::min(count, ringCapacity - first);
+    traceFile.write(reinterpret_cast<const char*>(ring->records.get() + first),
+                    firstCount * sizeof(MemTraceRecord));
+    if (firstCount < count) {
+      traceFile.write(reinterpret_cast<const char*>(ring->records.get()),
+                      (count - firstCount) * sizeof(MemTraceRecord));
+    }
+    ring->tail.store(head, std::memory_order_release);
+    numWritten += count;
+  }
+  return numWritten;
+}
+
+void writeOpName(std::string_view name, std::string_view suffix = {}) {
+  const auto length = static_cast<std::uint8_t>(name.size() + suffix.size());
+  traceFile.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  traceFile.write(name.data(), name.size());
+  traceFile.write(suffix.data(), suffix.size());
+}
+
+void appendRecord(std::size_t op, NodeIndex source, NodeIndex dest, std::size_t size,
+                  GlobalAddress globalAddress) {
+  if (threadRing == nullptr) {
+    threadRing = registerThreadRing();
+  }
+
+  MemTraceRecord record{};
+  record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - startTime)
+                         .count();
+  record.globalAddress = globalAddress;
+  record.size = static_cast<std::uint32_t>(size);
+  record.source = static_cast<std::uint16_t>(source.id);
+  record.dest = static_cast<std::uint16_t>(dest.id);
+  record.op = static_cast<std::uint8_t>(op);
+  record.memType = (globalAddress == 0)
+                       ? noMemoryType
+                       : static_cast<std::uint8_t>(extractMemoryType(globalAddress));
+
+  auto& ring = *threadRing;
+  const auto head = ring.head.load(std::memory_order_relaxed);
+  // wait for the draining thread if the ring buffer is full
+  while (head - ring.tail.load(std::memory_order_acquire) >= ringCapacity) {
+    std::this_thread::yield();
+  }
+  ring.records[head % ringCapacity] = record;
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+void drainLoop() {
+  while (!stopDraining.load(std::memory_order_acquire)) {
+    if (drainRings() == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+} // namespace
+
+[[nodiscard]] Status MemTraceBuffer::initialize(NodeIndex nodeIdx) {
+  std::string prefix = "";
+  if (auto filePrefixEnv = std::getenv("PANDO_TRACING_MEM_FILE_PREFIX");
+      filePrefixEnv != nullptr) {
+    prefix = std::string(filePrefixEnv) + "_";
+  }
+
+  std::string filePath = prefix + "pando_mem_trace_node_" + std::to_string(nodeIdx.id) + ".bin";
+  traceFile.open(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!traceFile.is_open()) {
+    SPDLOG_ERROR("Could not open memory trace file {}", filePath);
+    return Status::Error;
+  }
+
+  const std::uint32_t node = nodeIdx.id;
+  const std::uint32_t numOpNames = numRecordOps;
+  traceFile.write("PMTR", 4);
+  traceFile.write(reinterpret_cast<const char*>(&formatVersion), sizeof(formatVersion));
+  traceFile.write(reinterpret_cast<const char*>(&node), sizeof(node));
+  traceFile.write(reinterpret_cast<const char*>(&numOpNames), sizeof(numOpNames));
+  for (std::size_t op = 0; op < numOps; ++op) {
+    writeOpName(memTraceOpName(static_cast<MemTraceOp>(op)));
+  }
+  for (std::size_t op = 0; op < numOps; ++op) {
+    writeOpName(memTraceOpName(static_cast<MemTraceOp>(op)), "_REQUEST");
+  }
+  for (std::size_t message = 0; message < numMessages; ++message) {
+    writeOpName(memTraceMessageName(static_cast<MemTraceMessage>(message)));
+  }
+
+  startTime = std::chrono::steady_clock::now();
+  stopDraining = false;
+  drainer = std::thread(drainLoop);
+  isActive.store(true, std::memory_order_release);
+
+  return Status::Success;
+}
+
+bool MemTraceBuffer::isEnabled() noexcept {
+  return isActive.load(std::memory_order_relaxed);
+}
+
+void MemTraceBuffer::append(MemTraceOp op, NodeIndex source, NodeIndex dest, std::size_t size,
+                            GlobalAddress globalAddress) {
+  appendRecord(static_cast<std::size_t>(op), source, dest, size, globalAddress);
+}
+
+void MemTraceBuffer::appendRequest(MemTraceOp op, NodeIndex source, NodeIndex dest) {
+  appendRecord(firstRequestOp + static_cast<std::size_t>(op), source, dest, 0, 0);
+}
+
+void MemTraceBuffer::append(MemTraceMessage message, NodeIndex source, NodeIndex dest) {
+  appendRecord(firstMessageOp + static_cast<std::size_t>(message), source, dest, 0, 0);
+}
+
+void MemTraceBuffer::finalize() {
+  if (!isActive.exchange(false)) {
+    return;
+  }
+  stopDraining.store(true, std::memory_order_release);
+  drainer.join();
+  drainRings();
+  traceFile.close();
+}
+
+} // namespace pando
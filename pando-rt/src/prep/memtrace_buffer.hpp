@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
+
+#ifndef PANDO_RT_SRC_PREP_MEMTRACE_BUFFER_HPP_
+#define PANDO_RT_SRC_PREP_MEMTRACE_BUFFER_HPP_
+
+#include <cstdint>
+
+#include "memtrace_stat.hpp"
+#include "pando-rt/index.hpp"
+#include "pando-rt/memory/global_ptr_fwd.hpp"
+#include "pando-rt/status.hpp"
+
+namespace pando {
+
+/**
+ * @brief Fixed-size binary memory trace record.
+ *
+ * @ingroup PREP
+ */
+struct MemTraceRecord {
+  std::uint64_t timestamp;     // nanoseconds since the buffer was initialized
+  std::uint64_t globalAddress; // 0 for messages without an address
+  std::uint32_t size;
+  std::uint16_t source;
+  std::uint16_t dest;
+  std::uint8_t op;      // index in the op name table of the trace file
+  std::uint8_t memType; // pando::MemoryType or 0xff if there is no address
+  std::uint8_t reserved[6];
+};
+
+static_assert(sizeof(MemTraceRecord) == 32);
+
+/**
+ * @brief Binary memory trace support.
+ *
+ * Each thread appends @ref MemTraceRecord objects to its own single-producer ring buffer without
+ * locking. A background thread drains the ring buffers in large blocks to a per-node file named
+ * `pando_mem_trace_node_<node>.bin`, prefixed with `PANDO_TRACING_MEM_FILE_PREFIX` if it is set.
+ *
+ * The file starts with a header of the magic `PMTR`, a `u32` version, a `u32` node index, a `u32`
+ * number of op names and for each op name a `u8` length followed by the name, followed by the
+ * records in native endianness. Records of different threads are not ordered by timestamp.
+ *
+ * The op names are the @ref MemTraceOp names, followed by the names of their requests with a
+ * `_REQUEST` suffix and by the @ref MemTraceMessage names, so the op of a record is its enumerator
+ * value, offset by the number of enumerators that precede it.
+ *
+ * @ingroup PREP
+ */
+class MemTraceBuffer {
+public:
+  /**
+   * @brief Opens the trace file of node @p nodeIdx and starts the draining thread.
+   */
+  [[nodiscard]] static Status initialize(NodeIndex nodeIdx);
+
+  /**
+   * @brief Returns if the binary trace is active.
+   */
+  static bool isEnabled() noexcept;
+
+  /**
+   * @brief Appends a record of operation @p op to the ring buffer of the calling thread.
+   *
+   * @note If the ring buffer is full, the caller waits for the draining thread.
+   */
+  static void append(MemTraceOp op, NodeIndex source, NodeIndex dest, std::size_t size,
+                     GlobalAddress globalAddress);
+
+  /**
+   * @brief Appends a record of a request of operation @p op to the ring buffer of the calling
+   *        thread.
+   */
+  static void appendRequest(MemTraceOp op, NodeIndex source, NodeIndex dest);
+
+  /**
+   * @brief Appends a record of @p message to the ring buffer of the calling thread.
+   */
+  static void append(MemTraceMessage message, NodeIndex source, NodeIndex dest);
+
+  /**
+   * @brief Stops the draining thread, writes any remaining records and closes the trace file.
+   */
+  static void finalize();
+};
+
+} // namespace pando
+
+#endif // PANDO_RT_SRC_PREP_MEMTRACE_BUFFER_HPP_
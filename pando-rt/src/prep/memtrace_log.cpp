@@ -6,6 +6,7 @@
 #include "spdlog/fmt/bin_to_hex.h"
 #include "spdlog/spdlog.h"
 
+#include "memtrace_buffer.hpp"
 #include "memtrace_stat.hpp"
 #include "pando-rt/memory/address_translation.hpp"
 
@@ -20,47 +21,45 @@ const bool isPayloadEnabled = []() -> bool {
     return true;
   }
 }();
-}
-
-void MemTraceLogger::log(std::string_view const op, pando::NodeIndex source, pando::NodeIndex dest,
-                         std::size_t size, const void* localBuffer, GlobalAddress globalAddress) {
-#if PANDO_RT_ENABLE_MEM_STAT
-  // do not count ACK and REQUEST messages
-  size_t ackFound = op.find("ACK");
-  size_t requestFound = op.find("REQUEST");
-
-  if (ackFound == std::string_view::npos && requestFound == std::string_view::npos) {
-    MemTraceStat::add(op, source, size);
-  }
-
-#ifndef PANDO_RT_TRACE_MEM_PREP
-  static_cast<void>(dest);
-  static_cast<void>(localBuffer);
-  static_cast<void>(globalAddress);
-#endif
-#endif
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
+// Returns if messages from source to dest are traced
+bool isTraced(pando::NodeIndex source, pando::NodeIndex dest) {
 #if PANDO_RT_TRACE_MEM_PREP == 1 // INTER-PXN Memory Trace is enabled
   // When both INTER-PXN TRACE feature and PANDO_RT_ENABLE_MEM_STAT feature are both enabled
-  // this function is still called for the sake of counting intra-pxn memory stats,
+  // the loggers are still called for the sake of counting intra-pxn memory stats,
   // however we don't want to trace INTRA-PXN memory operations, so make sure to early return
   // when the source and dest is the same node.
-  if (source == dest) {
+  return source != dest;
+#else
+  static_cast<void>(source);
+  static_cast<void>(dest);
+  return true;
+#endif
+}
+
+// Writes a memory operation to the binary trace or to spdlog
+void trace(MemTraceOp op, pando::NodeIndex source, pando::NodeIndex dest, std::size_t size,
+           const void* localBuffer, GlobalAddress globalAddress) {
+  if (!isTraced(source, dest)) {
     return;
   }
-#endif
+  if (MemTraceBuffer::isEnabled()) {
+    MemTraceBuffer::append(op, source, dest, size, globalAddress);
+    return;
+  }
+  const auto opName = memTraceOpName(op);
   if (globalAddress == 0) {
-    if (op == "FUNC") {
+    if (op == MemTraceOp::Func) {
       if (isPayloadEnabled) {
-        spdlog::info("[MEM] {} {}-{} {} ({:n} )", op, source.id, dest.id, size,
+        spdlog::info("[MEM] {} {}-{} {} ({:n} )", opName, source.id, dest.id, size,
                      spdlog::to_hex(static_cast<const std::byte*>(localBuffer),
                                     static_cast<const std::byte*>(localBuffer) + size));
       } else {
-        spdlog::info("[MEM] {} {}-{} {}", op, source.id, dest.id, size);
+        spdlog::info("[MEM] {} {}-{} {}", opName, source.id, dest.id, size);
       }
     } else {
-      spdlog::info("[MEM] {} {}-{}", op, source.id, dest.id);
+      spdlog::info("[MEM] {} {}-{}", opName, source.id, dest.id);
     }
   } else {
     std::string_view memType;
@@ -81,15 +80,88 @@ void MemTraceLogger::log(std::string_view const op, pando::NodeIndex source, pan
     }
 
     if (isPayloadEnabled) {
-      spdlog::info("[MEM] {} {} {}-{} {} {:x} ({:n} )", op, memType, source.id, dest.id, size,
+      spdlog::info("[MEM] {} {} {}-{} {} {:x} ({:n} )", opName, memType, source.id, dest.id, size,
                    globalAddress,
                    spdlog::to_hex(static_cast<const std::byte*>(localBuffer),
                                   static_cast<const std::byte*>(localBuffer) + size));
     } else {
-      spdlog::info("[MEM] {} {} {}-{} {} {:x}", op, memType, source.id, dest.id, size,
+      spdlog::info("[MEM] {} {} {}-{} {} {:x}", opName, memType, source.id, dest.id, size,
                    globalAddress);
     }
   }
+}
+#endif
+} // namespace
+
+[[nodiscard]] Status MemTraceLogger::initialize(NodeIndex nodeIdx) {
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  if (auto format = std::getenv("PANDO_TRACING_MEM_FORMAT");
+      format != nullptr && std::string_view(format) == "binary") {
+    return MemTraceBuffer::initialize(nodeIdx);
+  }
+#else
+  static_cast<void>(nodeIdx);
+#endif
+  return Status::Success;
+}
+
+void MemTraceLogger::finalize() {
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceBuffer::finalize();
+#endif
+}
+
+void MemTraceLogger::log(MemTraceOp op, pando::NodeIndex source, pando::NodeIndex dest,
+                         std::size_t size, const void* localBuffer, GlobalAddress globalAddress) {
+#if PANDO_RT_ENABLE_MEM_STAT
+  MemTraceStat::add(op, source, size);
+#endif
+
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  trace(op, source, dest, size, localBuffer, globalAddress);
+#else
+  static_cast<void>(dest);
+  static_cast<void>(localBuffer);
+  static_cast<void>(globalAddress);
+#if !PANDO_RT_ENABLE_MEM_STAT
+  static_cast<void>(op);
+  static_cast<void>(source);
+  static_cast<void>(size);
+#endif
+#endif
+}
+
+void MemTraceLogger::logRequest(MemTraceOp op, pando::NodeIndex source, pando::NodeIndex dest) {
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  if (!isTraced(source, dest)) {
+    return;
+  }
+  if (MemTraceBuffer::isEnabled()) {
+    MemTraceBuffer::appendRequest(op, source, dest);
+    return;
+  }
+  spdlog::info("[MEM] {}_REQUEST {}-{}", memTraceOpName(op), source.id, dest.id);
+#else
+  static_cast<void>(op);
+  static_cast<void>(source);
+  static_cast<void>(dest);
+#endif
+}
+
+void MemTraceLogger::log(MemTraceMessage message, pando::NodeIndex source, pando::NodeIndex dest) {
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  if (!isTraced(source, dest)) {
+    return;
+  }
+  if (MemTraceBuffer::isEnabled()) {
+    MemTraceBuffer::append(message, source, dest);
+    return;
+  }
+  spdlog::info("[MEM] {} {}-{}", memTraceMessageName(message), source.id, dest.id);
+#else
+  static_cast<void>(message);
+  static_cast<void>(source);
+  static_cast<void>(dest);
 #endif
 }
 } // namespace pando
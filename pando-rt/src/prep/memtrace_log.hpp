@@ -4,10 +4,10 @@
 #ifndef PANDO_RT_SRC_PREP_MEMTRACE_LOG_HPP_
 #define PANDO_RT_SRC_PREP_MEMTRACE_LOG_HPP_
 
-#include <string_view>
-
+#include "memtrace_stat.hpp"
 #include "pando-rt/index.hpp"
 #include "pando-rt/memory/global_ptr_fwd.hpp"
+#include "pando-rt/status.hpp"
 
 namespace pando {
 
@@ -19,11 +19,41 @@ namespace pando {
 class MemTraceLogger {
 public:
   /**
-   * @brief Logs memory operations using spdlog at INFO level.
+   * @brief Initializes memory tracing for node @p nodeIdx.
+   *
+   * If `PANDO_TRACING_MEM_FORMAT` is set to `binary`, memory operations are written to a binary
+   * trace file through @ref MemTraceBuffer instead of being logged as text.
+   */
+  [[nodiscard]] static Status initialize(NodeIndex nodeIdx);
+
+  /**
+   * @brief Flushes and closes the binary trace file, if any.
+   */
+  static void finalize();
+
+  /**
+   * @brief Logs memory operation @p op using spdlog at INFO level or to the binary trace and
+   *        counts it in the memory stats.
    */
-  static void log(std::string_view const op, pando::NodeIndex source, pando::NodeIndex dest,
+  static void log(MemTraceOp op, pando::NodeIndex source, pando::NodeIndex dest,
                   std::size_t size = 0, const void* localBuffer = nullptr,
                   GlobalAddress globalAddress = 0);
+
+  /**
+   * @brief Logs a request of memory operation @p op using spdlog at INFO level or to the binary
+   *        trace.
+   *
+   * @note Requests are not counted in the memory stats; the operation is counted by the node that
+   *       performs it.
+   */
+  static void logRequest(MemTraceOp op, pando::NodeIndex source, pando::NodeIndex dest);
+
+  /**
+   * @brief Logs @p message using spdlog at INFO level or to the binary trace.
+   *
+   * @note Messages are not counted in the memory stats.
+   */
+  static void log(MemTraceMessage message, pando::NodeIndex source, pando::NodeIndex dest);
 };
 } // namespace pando
 
@@ -3,12 +3,14 @@
 
 #include "memtrace_stat.hpp"
 
+#include <array>
+#include <atomic>
 #include <cstdlib>
 #include <fstream>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #include "log.hpp"
 #include "pando-rt/locality.hpp"
@@ -17,10 +19,43 @@ namespace pando {
 
 namespace {
 
+constexpr std::size_t numOps = static_cast<std::size_t>(MemTraceOp::Count);
+
+constexpr std::array<std::string_view, numOps> opNames{
+    "FUNC",
+    "LOAD",
+    "STORE",
+    "ATOMIC_LOAD",
+    "ATOMIC_STORE",
+    "ATOMIC_COMPARE_EXCHANGE",
+    "ATOMIC_INCREMENT",
+    "ATOMIC_DECREMENT",
+    "ATOMIC_FETCH_ADD",
+    "ATOMIC_FETCH_SUB",
+    "ATOMIC_FETCH_MIN",
+    "ATOMIC_FETCH_MAX",
+    "ATOMIC_FETCH_OR",
+    "ATOMIC_FETCH_AND",
+    "DMA",
+    "WAIT_GROUP",
+};
+
+constexpr std::size_t numMessages = static_cast<std::size_t>(MemTraceMessage::Count);
+
+constexpr std::array<std::string_view, numMessages> messageNames{
+    "LOAD_ACK",
+    "ACK",
+    "VALUE_ACK",
+};
+
 std::uint64_t countInGranularity(std::uint64_t bytes) {
   return ((bytes + 15) / 16);
 }
 
+// Counters kept for each (source node, operation) pair. The bytes in 16B granularity are derived
+// from the count in 16B granularity.
+enum Counter : std::size_t { CountOperations = 0, CountGranularity, Bytes, NumCounters };
+
 struct MemStat {
   std::uint64_t bytes{};
   std::uint64_t bytes_granularity{};
@@ -28,14 +63,68 @@ struct MemStat {
   std::uint64_t count_operations{};
 };
 
+// Binary stat file layout (native endianness):
+//   header: "PMST", u32 version, u32 destination node, u32 number of nodes, u32 number of ops,
+//           then for each op a u8 name length followed by the name
+//   kernel record: u8 kernelRecord, u32 name length, name
+//   phase record: u8 phaseRecord, u32 phase, u32 number of entries, then for each entry
+//                 u32 source node, u8 op, u64 count, u64 count (16B granularity), u64 bytes
+constexpr std::uint32_t binaryFormatVersion = 1;
+constexpr std::uint8_t kernelRecord = 1;
+constexpr std::uint8_t phaseRecord = 2;
+
 std::ofstream stat_file;
+bool isBinary = false;
+// protects the stat file and the aggregated counters
 std::mutex mutex;
-std::unique_ptr<std::unordered_map<std::string, MemStat>[]> stats;
 std::uint32_t phaseCount = 1;
 NodeIndex numOfNodes;
-bool isDirty = false;
+
+// counters already written in previous phases
+std::vector<std::array<std::uint64_t, NumCounters>> written;
+
+// per-thread counters; each thread only updates its own counters and the counters are read when
+// a phase is written
+std::mutex countersMutex;
+std::vector<std::unique_ptr<std::atomic<std::uint64_t>[]>> allCounters;
+thread_local std::atomic<std::uint64_t>* threadCounters = nullptr;
+
+std::size_t numCounterSlots() {
+  return static_cast<std::size_t>(numOfNodes.id) * numOps * NumCounters;
+}
+
+std::atomic<std::uint64_t>* registerThreadCounters() {
+  auto counters = std::make_unique<std::atomic<std::uint64_t>[]>(numCounterSlots());
+  auto ptr = counters.get();
+  std::lock_guard<std::mutex> lock(countersMutex);
+  allCounters.push_back(std::move(counters));
+  return ptr;
+}
+
+void increment(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+  // only the owning thread writes the counter, so no read-modify-write is needed
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+template <typename T>
+void writeBinary(const T& value) {
+  stat_file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeBinary(std::string_view value) {
+  stat_file.write(value.data(), value.size());
+}
+
 } // namespace
 
+std::string_view memTraceOpName(MemTraceOp op) noexcept {
+  return opNames[static_cast<std::size_t>(op)];
+}
+
+std::string_view memTraceMessageName(MemTraceMessage message) noexcept {
+  return messageNames[static_cast<std::size_t>(message)];
+}
+
 [[nodiscard]] Status MemTraceStat::initialize(NodeIndex nodeIdx, NodeIndex nodeDims) {
   if (!isOnCP()) {
     SPDLOG_ERROR("MemTraceStat can only be initialized from the CP");
@@ -51,99 +140,150 @@ bool isDirty = false;
     prefix = std::string(filePrefixEnv) + "_";
   }
 
-  std::string filePath = prefix + "pando_mem_stat_node_" + std::to_string(nodeIdx.id) + ".trace";
+  if (auto formatEnv = std::getenv("PANDO_TRACING_MEM_STAT_FORMAT"); formatEnv != nullptr) {
+    isBinary = (std::string_view(formatEnv) == "binary");
+  }
+
+  std::string filePath = prefix + "pando_mem_stat_node_" + std::to_string(nodeIdx.id) +
+                         (isBinary ? ".bin" : ".trace");
 
-  stat_file.open(filePath, std::ios::out | std::ios::trunc);
+  if (isBinary) {
+    stat_file.open(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
+  } else {
+    stat_file.open(filePath, std::ios::out | std::ios::trunc);
+  }
 
   if (!stat_file.is_open()) {
     return Status::Error;
   }
 
-  stats = std::make_unique<std::unordered_map<std::string, MemStat>[]>(nodeDims.id);
-
-  stat_file << "Destination Node: " << nodeIdx.id << "\n\n";
+  written.assign(static_cast<std::size_t>(nodeDims.id) * numOps, {});
+
+  if (isBinary) {
+    writeBinary(std::string_view("PMST"));
+    writeBinary(binaryFormatVersion);
+    writeBinary(static_cast<std::uint32_t>(nodeIdx.id));
+    writeBinary(static_cast<std::uint32_t>(nodeDims.id));
+    writeBinary(static_cast<std::uint32_t>(numOps));
+    for (auto name : opNames) {
+      writeBinary(static_cast<std::uint8_t>(name.size()));
+      writeBinary(name);
+    }
+  } else {
+    stat_file << "Destination Node: " << nodeIdx.id << "\n\n";
+  }
 
   return Status::Success;
 }
 
-void MemTraceStat::add(std::string_view op, pando::NodeIndex other, std::size_t size) {
+void MemTraceStat::add(MemTraceOp op, pando::NodeIndex other, std::size_t size) {
   if (other >= numOfNodes) {
     SPDLOG_ERROR("Node index out of bounds: {}", other.id);
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex);
-
-  auto key = std::string(op);
-  auto& htable = stats[other.id];
-  auto it = htable.find(key);
-  auto cGranularity = countInGranularity(size);
-  if (it != htable.end()) {
-    it->second.bytes += size;
-    it->second.count_operations += 1;
-    it->second.bytes_granularity += cGranularity * 16;
-    it->second.count_granularity += cGranularity;
-  } else {
-    MemStat stat;
-    stat.bytes = size;
-    stat.count_operations = 1;
-    stat.bytes_granularity = cGranularity * 16;
-    stat.count_granularity = cGranularity;
-    htable[key] = stat;
+  if (threadCounters == nullptr) {
+    threadCounters = registerThreadCounters();
   }
 
-  isDirty = true;
+  const auto slot =
+      (static_cast<std::size_t>(other.id) * numOps + static_cast<std::size_t>(op)) * NumCounters;
+  increment(threadCounters[slot + CountOperations], 1);
+  increment(threadCounters[slot + CountGranularity], countInGranularity(size));
+  increment(threadCounters[slot + Bytes], size);
 }
 
 void MemTraceStat::startKernel(std::string_view kernelName) {
   // trying to start a new kernel section but there's data still
   // from the previous phase, waiting to be written, so flush them first
-  if (isDirty) {
-    writePhase();
-  }
+  writePhase();
 
   std::lock_guard<std::mutex> lock(mutex);
 
-  stat_file << "### Kernel: " << kernelName << " ###\n";
+  if (isBinary) {
+    writeBinary(kernelRecord);
+    writeBinary(static_cast<std::uint32_t>(kernelName.size()));
+    writeBinary(kernelName);
+  } else {
+    stat_file << "### Kernel: " << kernelName << " ###\n";
+  }
   phaseCount = 1;
 }
 
 void MemTraceStat::writePhase() {
   std::lock_guard<std::mutex> lock(mutex);
 
-  if (!isDirty)
-    return;
+  // aggregate the counters of all threads and compute what was counted since the last phase
+  std::vector<std::array<std::uint64_t, NumCounters>> totals(written.size());
+  {
+    std::lock_guard<std::mutex> countersLock(countersMutex);
+    for (const auto& counters : allCounters) {
+      for (std::size_t i = 0; i < totals.size(); ++i) {
+        for (std::size_t c = 0; c < NumCounters; ++c) {
+          totals[i][c] += counters[i * NumCounters + c].load(std::memory_order_relaxed);
+        }
+      }
+    }
+  }
 
-  stat_file << "Phase: " << phaseCount << "\n";
+  std::vector<MemStat> phase(totals.size());
+  std::uint32_t numEntries = 0;
+  for (std::size_t i = 0; i < totals.size(); ++i) {
+    auto& stat = phase[i];
+    stat.count_operations = totals[i][CountOperations] - written[i][CountOperations];
+    stat.count_granularity = totals[i][CountGranularity] - written[i][CountGranularity];
+    stat.bytes_granularity = stat.count_granularity * 16;
+    stat.bytes = totals[i][Bytes] - written[i][Bytes];
+    if (stat.count_operations != 0) {
+      ++numEntries;
+    }
+  }
+  written = std::move(totals);
 
-  for (int i = 0; i < numOfNodes.id; ++i) {
-    stat_file << "Source Node: " << i << "\n";
-    for (auto& pair : stats[i]) {
-      if (pair.second.count_operations == 0) // do not log stats with zero values
-        continue;
+  if (numEntries == 0)
+    return;
 
-      // write the count stat to the file
-      stat_file << pair.first << " (count): " << pair.second.count_operations << "\n";
-      // write the count granularity stat to the file
-      stat_file << pair.first << " (count - 16B granularity): " << pair.second.count_granularity
-                << "\n";
-      // write the bytes stat to the file
-      stat_file << pair.first << " (bytes): " << pair.second.bytes << "\n";
-      stat_file << pair.first << " (bytes - 16B granularity): " << pair.second.bytes_granularity
-                << "\n";
-
-      // reset the stat
-      pair.second = MemStat();
+  if (isBinary) {
+    writeBinary(phaseRecord);
+    writeBinary(phaseCount);
+    writeBinary(numEntries);
+    for (std::size_t i = 0; i < phase.size(); ++i) {
+      const auto& stat = phase[i];
+      if (stat.count_operations == 0) // do not log stats with zero values
+        continue;
+      writeBinary(static_cast<std::uint32_t>(i / numOps));
+      writeBinary(static_cast<std::uint8_t>(i % numOps));
+      writeBinary(stat.count_operations);
+      writeBinary(stat.count_granularity);
+      writeBinary(stat.bytes);
+    }
+  } else {
+    stat_file << "Phase: " << phaseCount << "\n";
+
+    for (int i = 0; i < numOfNodes.id; ++i) {
+      stat_file << "Source Node: " << i << "\n";
+      for (std::size_t op = 0; op < numOps; ++op) {
+        const auto& stat = phase[i * numOps + op];
+        if (stat.count_operations == 0) // do not log stats with zero values
+          continue;
+
+        const auto name = opNames[op];
+        // write the count stat to the file
+        stat_file << name << " (count): " << stat.count_operations << "\n";
+        // write the count granularity stat to the file
+        stat_file << name << " (count - 16B granularity): " << stat.count_granularity << "\n";
+        // write the bytes stat to the file
+        stat_file << name << " (bytes): " << stat.bytes << "\n";
+        stat_file << name << " (bytes - 16B granularity): " << stat.bytes_granularity << "\n";
+      }
     }
-  }
 
-  stat_file << "\n";
+    stat_file << "\n";
+  }
 
   stat_file.flush();
 
   phaseCount++;
-
-  isDirty = false;
 }
 
 void MemTraceStat::finalize() {
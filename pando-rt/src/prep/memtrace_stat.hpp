@@ -4,6 +4,7 @@
 #ifndef PANDO_RT_SRC_PREP_MEMTRACE_STAT_HPP_
 #define PANDO_RT_SRC_PREP_MEMTRACE_STAT_HPP_
 
+#include <cstdint>
 #include <string_view>
 
 #include "pando-rt/index.hpp"
@@ -11,9 +12,61 @@
 
 namespace pando {
 
+/**
+ * @brief Memory operations counted by @ref MemTraceStat.
+ *
+ * @ingroup PREP
+ */
+enum class MemTraceOp : std::uint8_t {
+  Func = 0,
+  Load,
+  Store,
+  AtomicLoad,
+  AtomicStore,
+  AtomicCompareExchange,
+  AtomicIncrement,
+  AtomicDecrement,
+  AtomicFetchAdd,
+  AtomicFetchSub,
+  AtomicFetchMin,
+  AtomicFetchMax,
+  AtomicFetchOr,
+  AtomicFetchAnd,
+  DMA,
+  WaitGroup,
+  Count
+};
+
+/**
+ * @brief Messages traced in addition to the requests of @ref MemTraceOp operations.
+ *
+ * @ingroup PREP
+ */
+enum class MemTraceMessage : std::uint8_t { LoadAck = 0, Ack, ValueAck, Count };
+
+/**
+ * @brief Returns the name of @p op as written in the memory stat and trace files.
+ *
+ * @ingroup PREP
+ */
+std::string_view memTraceOpName(MemTraceOp op) noexcept;
+
+/**
+ * @brief Returns the name of @p message as written in the memory trace files.
+ *
+ * @ingroup PREP
+ */
+std::string_view memTraceMessageName(MemTraceMessage message) noexcept;
+
 /**
  * @brief Memory access statistics logging support.
  *
+ * Every thread counts its operations in its own matrix of counters indexed by operation and
+ * source node without any locking. The matrices are aggregated only when a phase is written.
+ *
+ * If `PANDO_TRACING_MEM_STAT_FORMAT` is set to `binary`, the statistics are written in a compact
+ * binary format instead of text.
+ *
  * @ingroup PREP
  */
 class MemTraceStat {
@@ -24,9 +77,9 @@ public:
   [[nodiscard]] static Status initialize(NodeIndex nodeIdx, NodeIndex nodeDims);
 
   /**
-   * @brief Add the corresponding counters into the internal container.
+   * @brief Add the corresponding counters into the counters of the calling thread.
    */
-  static void add(std::string_view op, pando::NodeIndex other, std::size_t size = 0);
+  static void add(MemTraceOp op, pando::NodeIndex other, std::size_t size = 0);
 
   /**
    * @brief Write memory stat counters as a new phase
@@ -15,6 +15,7 @@
 #include "gasnet.h"
 #include "gasnet_coll.h"
 
+#include "../native_atomic.hpp"
 #include "config.hpp"
 #include "data_type.hpp"
 #include "index.hpp"
@@ -40,6 +41,10 @@ enum class AMType : std::size_t {
   AtomicDecrement,
   AtomicFetchAdd,
   AtomicFetchSub,
+  AtomicFetchMin,
+  AtomicFetchMax,
+  AtomicFetchOr,
+  AtomicFetchAnd,
   LoadAck,
   Ack,
   ValueAck,
@@ -130,6 +135,18 @@ void handleAtomicFetchAdd(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
 // Processes an atomic fetch-sub request
 void handleAtomicFetchSub(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
                           gex_AM_Arg_t handlePtrLo);
+// Processes an atomic fetch-min request
+void handleAtomicFetchMin(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
+                          gex_AM_Arg_t handlePtrLo);
+// Processes an atomic fetch-max request
+void handleAtomicFetchMax(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
+                          gex_AM_Arg_t handlePtrLo);
+// Processes an atomic fetch-or request
+void handleAtomicFetchOr(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
+                         gex_AM_Arg_t handlePtrLo);
+// Processes an atomic fetch-and request
+void handleAtomicFetchAnd(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi,
+                          gex_AM_Arg_t handlePtrLo);
 // Processes an ack for a load
 void handleLoadAck(gex_Token_t, void*, size_t, gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo);
 // Processes an ack
@@ -174,6 +191,14 @@ struct {
        (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
       {0, reinterpret_cast<gex_AM_Fn_t>(&handleAtomicFetchSub),
        (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
+      {0, reinterpret_cast<gex_AM_Fn_t>(&handleAtomicFetchMin),
+       (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
+      {0, reinterpret_cast<gex_AM_Fn_t>(&handleAtomicFetchMax),
+       (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
+      {0, reinterpret_cast<gex_AM_Fn_t>(&handleAtomicFetchOr),
+       (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
+      {0, reinterpret_cast<gex_AM_Fn_t>(&handleAtomicFetchAnd),
+       (GEX_FLAG_AM_REQUEST | GEX_FLAG_AM_MEDIUM), ptrNArgs, nullptr, nullptr},
 
       // acks
       {0, reinterpret_cast<gex_AM_Fn_t>(&handleLoadAck), (GEX_FLAG_AM_REQREP | GEX_FLAG_AM_MEDIUM),
@@ -221,8 +246,8 @@ void handleRequest(gex_Token_t token, void* buffer, size_t byteCount) {
   }
 
 #if PANDO_MEM_TRACE_OR_STAT
-  MemTraceLogger::log("FUNC", NodeIndex(getMessageSource(token)), NodeIndex(world.rank), byteCount,
-                      buffer);
+  MemTraceLogger::log(MemTraceOp::Func, NodeIndex(getMessageSource(token)), NodeIndex(world.rank),
+                      byteCount, buffer);
 #else
   static_cast<void>(token);
   static_cast<void>(byteCount);
@@ -250,8 +275,8 @@ void handleLoad(gex_Token_t token, void* buffer, size_t /*byteCount*/, gex_AM_Ar
   }
 
 #if PANDO_MEM_TRACE_OR_STAT
-  MemTraceLogger::log("LOAD", NodeIndex(getMessageSource(token)), NodeIndex(world.rank), n,
-                      srcDataPtr, srcAddr);
+  MemTraceLogger::log(MemTraceOp::Load, NodeIndex(getMessageSource(token)), NodeIndex(world.rank),
+                      n, srcDataPtr, srcAddr);
 #endif
 }
 
@@ -272,8 +297,8 @@ void handleStore(gex_Token_t token, void* buffer, size_t byteCount, gex_AM_Arg_t
   sendAck(token, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-  MemTraceLogger::log("STORE", NodeIndex(getMessageSource(token)), NodeIndex(world.rank), n,
-                      nativeDstPtr, dstAddr);
+  MemTraceLogger::log(MemTraceOp::Store, NodeIndex(getMessageSource(token)), NodeIndex(world.rank),
+                      n, nativeDstPtr, dstAddr);
 #endif
 }
 
@@ -287,8 +312,8 @@ struct AtomicLoadImpl {
     sendValue(token, retValue, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_LOAD", NodeIndex(getMessageSource(token)), NodeIndex(world.rank),
-                        sizeof(retValue), &retValue, srcAddr);
+    MemTraceLogger::log(MemTraceOp::AtomicLoad, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(retValue), &retValue, srcAddr);
 #endif
   }
 };
@@ -315,8 +340,8 @@ struct AtomicStoreImpl {
     sendAck(token, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_STORE", NodeIndex(getMessageSource(token)), NodeIndex(world.rank),
-                        sizeof(IntType), dstNativePtr, dstAddr);
+    MemTraceLogger::log(MemTraceOp::AtomicStore, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(IntType), dstNativePtr, dstAddr);
 #endif
   }
 };
@@ -347,7 +372,7 @@ struct AtomicCompareExchangeImpl {
     sendValue(token, *expectedPtr, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_COMPARE_EXCHANGE", NodeIndex(getMessageSource(token)),
+    MemTraceLogger::log(MemTraceOp::AtomicCompareExchange, NodeIndex(getMessageSource(token)),
                         NodeIndex(world.rank), sizeof(IntType), dstNativePtr, dstAddr);
 #endif
   }
@@ -376,7 +401,7 @@ struct AtomicIncImpl {
     sendAck(token, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_INCREMENT", NodeIndex(getMessageSource(token)),
+    MemTraceLogger::log(MemTraceOp::AtomicIncrement, NodeIndex(getMessageSource(token)),
                         NodeIndex(world.rank), sizeof(IntType), dstNativePtr, dstAddr);
 #endif
   }
@@ -404,7 +429,7 @@ struct AtomicDecImpl {
     sendAck(token, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_DECREMENT", NodeIndex(getMessageSource(token)),
+    MemTraceLogger::log(MemTraceOp::AtomicDecrement, NodeIndex(getMessageSource(token)),
                         NodeIndex(world.rank), sizeof(IntType), dstNativePtr, dstAddr);
 #endif
   }
@@ -432,7 +457,7 @@ struct AtomicFetchAddImpl {
     sendValue(token, retValue, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_FETCH_ADD", NodeIndex(getMessageSource(token)),
+    MemTraceLogger::log(MemTraceOp::AtomicFetchAdd, NodeIndex(getMessageSource(token)),
                         NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
 #endif
   }
@@ -461,7 +486,7 @@ struct AtomicFetchSubImpl {
     sendValue(token, retValue, handlePtrHi, handlePtrLo);
 
 #if PANDO_MEM_TRACE_OR_STAT
-    MemTraceLogger::log("ATOMIC_FETCH_SUB", NodeIndex(getMessageSource(token)),
+    MemTraceLogger::log(MemTraceOp::AtomicFetchSub, NodeIndex(getMessageSource(token)),
                         NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
 #endif
   }
@@ -479,6 +504,122 @@ void handleAtomicFetchSub(gex_Token_t token, void* buffer, size_t /*byteCount*/,
                    handlePtrLo);
 }
 
+// Processes an atomic fetch-min for an integral type
+struct AtomicFetchMinImpl {
+  template <typename IntType>
+  void operator()(gex_Token_t token, GlobalAddress dstAddr, const void* data,
+                  gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+    auto dstNativePtr = static_cast<IntType*>(Memory::getNativeAddress(dstAddr));
+    auto valuePtr = static_cast<const IntType*>(data);
+    IntType retValue = nativeAtomicFetchMin(dstNativePtr, *valuePtr, __ATOMIC_RELAXED);
+    sendValue(token, retValue, handlePtrHi, handlePtrLo);
+
+#if PANDO_MEM_TRACE_OR_STAT
+    MemTraceLogger::log(MemTraceOp::AtomicFetchMin, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
+#endif
+  }
+};
+
+// Processes an atomic fetch-min
+void handleAtomicFetchMin(gex_Token_t token, void* buffer, size_t /*byteCount*/,
+                          gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+  // unpack: payload number of bytes inferred from data type
+  GlobalAddress dstAddr;
+  DataType dataType;
+  const void* srcDataPtr = unpack(buffer, dstAddr, dataType);
+
+  dataTypeDispatch(dataType, AtomicFetchMinImpl{}, token, dstAddr, srcDataPtr, handlePtrHi,
+                   handlePtrLo);
+}
+
+// Processes an atomic fetch-max for an integral type
+struct AtomicFetchMaxImpl {
+  template <typename IntType>
+  void operator()(gex_Token_t token, GlobalAddress dstAddr, const void* data,
+                  gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+    auto dstNativePtr = static_cast<IntType*>(Memory::getNativeAddress(dstAddr));
+    auto valuePtr = static_cast<const IntType*>(data);
+    IntType retValue = nativeAtomicFetchMax(dstNativePtr, *valuePtr, __ATOMIC_RELAXED);
+    sendValue(token, retValue, handlePtrHi, handlePtrLo);
+
+#if PANDO_MEM_TRACE_OR_STAT
+    MemTraceLogger::log(MemTraceOp::AtomicFetchMax, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
+#endif
+  }
+};
+
+// Processes an atomic fetch-max
+void handleAtomicFetchMax(gex_Token_t token, void* buffer, size_t /*byteCount*/,
+                          gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+  // unpack: payload number of bytes inferred from data type
+  GlobalAddress dstAddr;
+  DataType dataType;
+  const void* srcDataPtr = unpack(buffer, dstAddr, dataType);
+
+  dataTypeDispatch(dataType, AtomicFetchMaxImpl{}, token, dstAddr, srcDataPtr, handlePtrHi,
+                   handlePtrLo);
+}
+
+// Processes an atomic fetch-or for an integral type
+struct AtomicFetchOrImpl {
+  template <typename IntType>
+  void operator()(gex_Token_t token, GlobalAddress dstAddr, const void* data,
+                  gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+    auto dstNativePtr = static_cast<IntType*>(Memory::getNativeAddress(dstAddr));
+    auto valuePtr = static_cast<const IntType*>(data);
+    IntType retValue = __atomic_fetch_or(dstNativePtr, *valuePtr, __ATOMIC_RELAXED);
+    sendValue(token, retValue, handlePtrHi, handlePtrLo);
+
+#if PANDO_MEM_TRACE_OR_STAT
+    MemTraceLogger::log(MemTraceOp::AtomicFetchOr, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
+#endif
+  }
+};
+
+// Processes an atomic fetch-or
+void handleAtomicFetchOr(gex_Token_t token, void* buffer, size_t /*byteCount*/,
+                         gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+  // unpack: payload number of bytes inferred from data type
+  GlobalAddress dstAddr;
+  DataType dataType;
+  const void* srcDataPtr = unpack(buffer, dstAddr, dataType);
+
+  dataTypeDispatch(dataType, AtomicFetchOrImpl{}, token, dstAddr, srcDataPtr, handlePtrHi,
+                   handlePtrLo);
+}
+
+// Processes an atomic fetch-and for an integral type
+struct AtomicFetchAndImpl {
+  template <typename IntType>
+  void operator()(gex_Token_t token, GlobalAddress dstAddr, const void* data,
+                  gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+    auto dstNativePtr = static_cast<IntType*>(Memory::getNativeAddress(dstAddr));
+    auto valuePtr = static_cast<const IntType*>(data);
+    IntType retValue = __atomic_fetch_and(dstNativePtr, *valuePtr, __ATOMIC_RELAXED);
+    sendValue(token, retValue, handlePtrHi, handlePtrLo);
+
+#if PANDO_MEM_TRACE_OR_STAT
+    MemTraceLogger::log(MemTraceOp::AtomicFetchAnd, NodeIndex(getMessageSource(token)),
+                        NodeIndex(world.rank), sizeof(retValue), &retValue, dstAddr);
+#endif
+  }
+};
+
+// Processes an atomic fetch-and
+void handleAtomicFetchAnd(gex_Token_t token, void* buffer, size_t /*byteCount*/,
+                          gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handlePtrLo) {
+  // unpack: payload number of bytes inferred from data type
+  GlobalAddress dstAddr;
+  DataType dataType;
+  const void* srcDataPtr = unpack(buffer, dstAddr, dataType);
+
+  dataTypeDispatch(dataType, AtomicFetchAndImpl{}, token, dstAddr, srcDataPtr, handlePtrHi,
+                   handlePtrLo);
+}
+
 // Processes an ack for a load
 void handleLoadAck(gex_Token_t token, void* buffer, size_t byteCount, gex_AM_Arg_t handlePtrHi,
                    gex_AM_Arg_t handlePtrLo) {
@@ -486,7 +627,8 @@ void handleLoadAck(gex_Token_t token, void* buffer, size_t byteCount, gex_AM_Arg
   handlePtr->setReady(buffer, byteCount);
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("LOAD_ACK", NodeIndex(world.rank), NodeIndex(getMessageSource(token)));
+  MemTraceLogger::log(MemTraceMessage::LoadAck, NodeIndex(world.rank),
+                      NodeIndex(getMessageSource(token)));
 #else
   static_cast<void>(token);
 #endif
@@ -498,7 +640,8 @@ void handleAck(gex_Token_t token, gex_AM_Arg_t handlePtrHi, gex_AM_Arg_t handleP
   handlePtr->setReady();
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ACK", NodeIndex(world.rank), NodeIndex(getMessageSource(token)));
+  MemTraceLogger::log(MemTraceMessage::Ack, NodeIndex(world.rank),
+                      NodeIndex(getMessageSource(token)));
 #else
   static_cast<void>(token);
 #endif
@@ -511,7 +654,8 @@ void handleValueAck(gex_Token_t token, void* buffer, size_t /*byteCount*/, gex_A
   handlePtr->setReady(buffer);
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("VALUE_ACK", NodeIndex(world.rank), NodeIndex(getMessageSource(token)));
+  MemTraceLogger::log(MemTraceMessage::ValueAck, NodeIndex(world.rank),
+                      NodeIndex(getMessageSource(token)));
 #else
   static_cast<void>(token);
 #endif
@@ -530,6 +674,49 @@ void processMessages(std::atomic<bool>& pollingActive) {
   // } while (pollingActive.load(std::memory_order_relaxed) == true);
 }
 
+// Sends a request of type amType that applies value to the object at dstAddr; the previous value of
+// the object is sent back to handle
+template <typename T>
+Status requestAtomicFetchOp(AMType amType, NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                            Nodes::ValueHandle<T>& handle) {
+  if (nodeIdx >= Nodes::getNodeDims()) {
+    SPDLOG_ERROR("Node index out of bounds: {}", nodeIdx);
+    return Status::OutOfBounds;
+  }
+
+  constexpr auto dataType = DataTypeTraits<T>::dataType;
+
+  // size payload
+  const auto requestSize = packedSize(dstAddr, dataType, value);
+
+  // get managed buffer to write the request in
+  const gex_Flags_t flags = 0;
+  const unsigned int numArgs = 2;
+  const auto maxMediumRequest =
+      gex_AM_MaxRequestMedium(world.team, nodeIdx.id, nullptr, flags, numArgs);
+  if (requestSize > maxMediumRequest) {
+    SPDLOG_ERROR("Request too large: {} > {}", requestSize, maxMediumRequest);
+    return Status::BadAlloc;
+  }
+  gex_AM_SrcDesc_t sd = gex_AM_PrepareRequestMedium(world.team, nodeIdx.id, nullptr, requestSize,
+                                                    requestSize, GEX_EVENT_NOW, flags, numArgs);
+  auto buffer = gex_AM_SrcDescAddr(sd);
+  if (buffer == nullptr) {
+    SPDLOG_ERROR("Could not allocate space to send to node {}", nodeIdx);
+    return Status::BadAlloc;
+  }
+
+  // pack payload
+  pack(buffer, dstAddr, dataType, value);
+  // pack pointer for reply
+  auto packedHandlePtr = packPtr(&handle);
+  // mark buffer ready for send
+  gex_AM_CommitRequestMedium2(sd, world.htable[+amType].gex_index, requestSize,
+                              std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
+
+  return Status::Success;
+}
+
 } // namespace
 
 Status Nodes::initialize() {
@@ -671,7 +858,7 @@ Status Nodes::load(NodeIndex nodeIdx, GlobalAddress srcAddr, std::size_t n, Load
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("LOAD_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::Load, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -714,7 +901,7 @@ Status Nodes::store(NodeIndex nodeIdx, GlobalAddress dstAddr, std::size_t n, con
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("STORE_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::Store, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -758,7 +945,7 @@ Status Nodes::atomicLoad(NodeIndex nodeIdx, GlobalAddress srcAddr, ValueHandle<T
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #if PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_LOAD_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicLoad, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -802,7 +989,7 @@ Status Nodes::atomicStore(NodeIndex nodeIdx, GlobalAddress dstAddr, T value, Ack
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_STORE_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicStore, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -848,7 +1035,7 @@ Status Nodes::atomicCompareExchange(NodeIndex nodeIdx, GlobalAddress dstAddr, T
                               std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_COMPARE_EXCHANGE_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicCompareExchange, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -893,7 +1080,7 @@ Status Nodes::atomicIncrement(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_INCREMENT_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicIncrement, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -938,7 +1125,7 @@ Status Nodes::atomicDecrement(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_DECREMENT_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicDecrement, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -983,7 +1170,7 @@ Status Nodes::atomicFetchAdd(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_FETCH_ADD_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchAdd, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
@@ -1028,12 +1215,60 @@ Status Nodes::atomicFetchSub(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
                               std::get<0>(packedHandlePtr), std::get<1>(packedHandlePtr));
 
 #ifdef PANDO_RT_TRACE_MEM_PREP
-  MemTraceLogger::log("ATOMIC_FETCH_SUB_REQUEST", getCurrentNode(), nodeIdx);
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchSub, getCurrentNode(), nodeIdx);
 #endif
 
   return Status::Success;
 }
 
+template <typename T>
+Status Nodes::atomicFetchMin(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                             ValueHandle<T>& handle) {
+  const auto status = requestAtomicFetchOp(AMType::AtomicFetchMin, nodeIdx, dstAddr, value, handle);
+
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchMin, getCurrentNode(), nodeIdx);
+#endif
+
+  return status;
+}
+
+template <typename T>
+Status Nodes::atomicFetchMax(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                             ValueHandle<T>& handle) {
+  const auto status = requestAtomicFetchOp(AMType::AtomicFetchMax, nodeIdx, dstAddr, value, handle);
+
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchMax, getCurrentNode(), nodeIdx);
+#endif
+
+  return status;
+}
+
+template <typename T>
+Status Nodes::atomicFetchOr(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                            ValueHandle<T>& handle) {
+  const auto status = requestAtomicFetchOp(AMType::AtomicFetchOr, nodeIdx, dstAddr, value, handle);
+
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchOr, getCurrentNode(), nodeIdx);
+#endif
+
+  return status;
+}
+
+template <typename T>
+Status Nodes::atomicFetchAnd(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                             ValueHandle<T>& handle) {
+  const auto status = requestAtomicFetchOp(AMType::AtomicFetchAnd, nodeIdx, dstAddr, value, handle);
+
+#ifdef PANDO_RT_TRACE_MEM_PREP
+  MemTraceLogger::logRequest(MemTraceOp::AtomicFetchAnd, getCurrentNode(), nodeIdx);
+#endif
+
+  return status;
+}
+
 void Nodes::barrier() {
   const gex_Flags_t flags = 0;
   gex_Event_Wait(gex_Coll_BarrierNB(world.team, flags));
@@ -1077,7 +1312,11 @@ INSTANTIATE_ATOMIC_LOAD_STORE(std::uint64_t)
   template Status Nodes::atomicIncrement<T>(NodeIndex, GlobalAddress, T, AckHandle&);     \
   template Status Nodes::atomicDecrement<T>(NodeIndex, GlobalAddress, T, AckHandle&);     \
   template Status Nodes::atomicFetchAdd<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&); \
-  template Status Nodes::atomicFetchSub<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&);
+  template Status Nodes::atomicFetchSub<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&); \
+  template Status Nodes::atomicFetchMin<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&); \
+  template Status Nodes::atomicFetchMax<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&); \
+  template Status Nodes::atomicFetchOr<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&);  \
+  template Status Nodes::atomicFetchAnd<T>(NodeIndex, GlobalAddress, T, ValueHandle<T>&);
 INSTANTIATE_ATOMICS(std::int32_t)
 INSTANTIATE_ATOMICS(std::uint32_t)
 INSTANTIATE_ATOMICS(std::int64_t)
@@ -330,6 +330,62 @@ public:
   [[nodiscard]] static Status atomicFetchSub(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
                                              ValueHandle<T>& handle);
 
+  /**
+   * @brief Performs a remote atomic fetch-min.
+   *
+   * @note The operation imposes no ordering at the destination node.
+   *
+   * @param[in]  nodeIdx destination node
+   * @param[in]  dstAddr global address of object to modify
+   * @param[in]  value   value to compare with
+   * @param[out] handle  handle to retrieve the result of the operation
+   */
+  template <typename T>
+  [[nodiscard]] static Status atomicFetchMin(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                                             ValueHandle<T>& handle);
+
+  /**
+   * @brief Performs a remote atomic fetch-max.
+   *
+   * @note The operation imposes no ordering at the destination node.
+   *
+   * @param[in]  nodeIdx destination node
+   * @param[in]  dstAddr global address of object to modify
+   * @param[in]  value   value to compare with
+   * @param[out] handle  handle to retrieve the result of the operation
+   */
+  template <typename T>
+  [[nodiscard]] static Status atomicFetchMax(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                                             ValueHandle<T>& handle);
+
+  /**
+   * @brief Performs a remote atomic fetch-or.
+   *
+   * @note The operation imposes no ordering at the destination node.
+   *
+   * @param[in]  nodeIdx destination node
+   * @param[in]  dstAddr global address of object to modify
+   * @param[in]  value   value to OR with
+   * @param[out] handle  handle to retrieve the result of the operation
+   */
+  template <typename T>
+  [[nodiscard]] static Status atomicFetchOr(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                                            ValueHandle<T>& handle);
+
+  /**
+   * @brief Performs a remote atomic fetch-and.
+   *
+   * @note The operation imposes no ordering at the destination node.
+   *
+   * @param[in]  nodeIdx destination node
+   * @param[in]  dstAddr global address of object to modify
+   * @param[in]  value   value to AND with
+   * @param[out] handle  handle to retrieve the result of the operation
+   */
+  template <typename T>
+  [[nodiscard]] static Status atomicFetchAnd(NodeIndex nodeIdx, GlobalAddress dstAddr, T value,
+                                             ValueHandle<T>& handle);
+
   /**
    * @brief Waits until all nodes reached the barrier.
    *
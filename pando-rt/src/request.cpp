@@ -6,16 +6,27 @@
 #include "pando-rt/stdlib.hpp"
 
 #include "prep/hart_context_fwd.hpp"
+#include "prep/load_balancer.hpp"
 #include "prep/nodes.hpp"
 
 namespace pando {
 
 Status detail::RequestBuffer::acquire(NodeIndex nodeIdx, std::size_t size) {
   m_size = size;
+  if (nodeIdx == anyNode) {
+    // pooled request; no metadata
+    m_storage = LoadBalancer::acquire(size);
+    m_metadata = nullptr;
+    return (m_storage != nullptr) ? Status::Success : Status::BadAlloc;
+  }
   return Nodes::requestAcquire(nodeIdx, size, &m_storage, &m_metadata);
 }
 
 void detail::RequestBuffer::release() {
+  if (m_metadata == nullptr) {
+    LoadBalancer::release(m_storage, m_size);
+    return;
+  }
   Nodes::requestRelease(m_size, m_metadata);
   //hartYield();
 }
@@ -17,6 +17,7 @@
 #ifdef PANDO_RT_USE_BACKEND_PREP
 #include "prep/cores.hpp"
 #include "prep/hart_context_fwd.hpp"
+#include "prep/load_balancer.hpp"
 #elif defined(PANDO_RT_USE_BACKEND_DRVX)
 #include "drvx/cores.hpp"
 #include "drvx/drvx.hpp"
@@ -52,6 +53,10 @@ extern "C" int __start(int argc, char** argv) {
 #endif
 
     do {
+#ifdef PANDO_RT_USE_BACKEND_PREP
+      // answer other nodes that asked for tasks from the pool of this node
+      pando::LoadBalancer::serviceStealRequests();
+#endif
       idleTimer.start();
       // for simulation accuracy purposes
       // getTaskQueue() records the memory access associated with dequeue
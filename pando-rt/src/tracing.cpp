@@ -17,7 +17,7 @@ void memStatNewKernel(std::string_view kernelName) {
 }
 
 void memStatWaitGroupAccess() {
-  MemTraceStat::add("WAIT_GROUP", pando::getCurrentPlace().node, sizeof(int64_t));
+  MemTraceStat::add(MemTraceOp::WaitGroup, pando::getCurrentPlace().node, sizeof(int64_t));
 }
 
 } // namespace pando
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved. */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "pando-rt/containers/array.hpp"
+#include "pando-rt/execution/execute_on.hpp"
+#include "pando-rt/sync/atomic.hpp"
+#include "pando-rt/sync/wait.hpp"
+
+namespace {
+
+constexpr std::uint64_t numTasks = 256;
+
+// Returns if pooled tasks are guaranteed to be taken by another node (or pod) when it is idle
+bool tasksMove(bool anyNodeTask) {
+  const auto dims = pando::getPlaceDims();
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+  // PREP models a single pod per node, so only anyNode tasks move
+  return anyNodeTask && (dims.node.id > 1);
+#elif defined(PANDO_RT_DRVX_WORK_STEALING)
+  return anyNodeTask ? (dims.node.id > 1) : (dims.pod.x > 1);
+#else
+  return false;
+#endif
+}
+
+// Task `id` of a test. While no task has moved away from the origin of the tasks, a task that
+// runs at the origin puts itself back in the pool, so the test only finishes if idle harts of
+// other nodes (or pods) steal pooled tasks.
+void runPooled(bool anyNodeTask, std::uint64_t id, pando::Place origin,
+               pando::GlobalPtr<std::uint64_t> runs, pando::GlobalPtr<std::uint64_t> movedRuns,
+               pando::GlobalPtr<std::uint64_t> done) {
+  const auto here = pando::getCurrentPlace();
+  const bool moved =
+      (here.node != origin.node) || (!anyNodeTask && (here.pod != origin.pod));
+  if (!moved && tasksMove(anyNodeTask) &&
+      pando::atomicLoad(movedRuns, std::memory_order_relaxed) == 0) {
+    if (anyNodeTask) {
+      EXPECT_EQ(pando::executeOn(pando::anyPlace, &runPooled, anyNodeTask, id, origin, runs,
+                                 movedRuns, done),
+                pando::Status::Success);
+    } else {
+      EXPECT_EQ(pando::executeOn(pando::anyPod, &runPooled, anyNodeTask, id, origin, runs,
+                                 movedRuns, done),
+                pando::Status::Success);
+    }
+    return;
+  }
+
+  pando::atomicIncrement(runs + id, std::uint64_t(1), std::memory_order_relaxed);
+  if (moved) {
+    pando::atomicIncrement(movedRuns, std::uint64_t(1), std::memory_order_relaxed);
+  }
+  pando::atomicIncrement(done, std::uint64_t(1), std::memory_order_release);
+}
+
+void checkPooledTasks(bool anyNodeTask) {
+  pando::Array<std::uint64_t> counters;
+  EXPECT_EQ(counters.initialize(numTasks + 2), pando::Status::Success);
+  for (auto counter : counters) {
+    counter = 0;
+  }
+  const auto runs = counters.data();
+  const auto movedRuns = runs + numTasks;
+  const auto done = movedRuns + 1;
+
+  const auto origin = pando::getCurrentPlace();
+  for (std::uint64_t id = 0; id < numTasks; id++) {
+    if (anyNodeTask) {
+      EXPECT_EQ(pando::executeOn(pando::anyPlace, &runPooled, anyNodeTask, id, origin, runs,
+                                 movedRuns, done),
+                pando::Status::Success);
+    } else {
+      EXPECT_EQ(pando::executeOn(pando::anyPod, &runPooled, anyNodeTask, id, origin, runs,
+                                 movedRuns, done),
+                pando::Status::Success);
+    }
+  }
+
+  pando::waitUntil([done] {
+    return pando::atomicLoad(done, std::memory_order_acquire) == numTasks;
+  });
+#if defined(PANDO_RT_USE_BACKEND_DRVX)
+  // pooled tasks are counted by the pod of their pool until they run; stolen tasks move their
+  // count to the pod that runs them
+  pando::waitAllTasks();
+#endif // PANDO_RT_USE_BACKEND_DRVX
+
+  for (std::uint64_t id = 0; id < numTasks; id++) {
+    EXPECT_EQ(runs[id], 1u);
+  }
+  if (tasksMove(anyNodeTask)) {
+    EXPECT_GT(*movedRuns, 0u);
+  }
+  counters.deinitialize();
+}
+
+} // namespace
+
+TEST(WorkStealing, AnyNodeTasksRunOnce) {
+  checkPooledTasks(true);
+}
+
+TEST(WorkStealing, AnyPodTasksRunOnce) {
+  checkPooledTasks(false);
+}
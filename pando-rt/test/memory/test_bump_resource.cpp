@@ -54,3 +54,36 @@ TYPED_TEST(BumpMemoryResourceTest, ExhaustTest) {
   auto FailedAllocation = memoryResource.allocate(1);
   EXPECT_EQ(FailedAllocation, nullptr);
 }
+
+TYPED_TEST(BumpMemoryResourceTest, RewindTest) {
+  static constexpr std::uint32_t minimumAlignment = 1;
+  using BumpResourceType = pando::BumpMemoryResource<minimumAlignment>;
+  static constexpr auto capacity = TypeParam::capacity;
+  static constexpr auto overhead = BumpResourceType::computeMetadataSize();
+  static constexpr auto totalBytes = capacity + overhead;
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  BumpResourceType memoryResource(buffer, totalBytes);
+  EXPECT_EQ(memoryResource.getUsedBytes(), 0u);
+
+  auto firstAllocation = memoryResource.allocate(2);
+  EXPECT_NE(firstAllocation, nullptr);
+  const auto mark = memoryResource.getUsedBytes();
+  EXPECT_EQ(mark, 2u);
+
+  auto secondAllocation = memoryResource.allocate(capacity - 2);
+  EXPECT_NE(secondAllocation, nullptr);
+  EXPECT_EQ(memoryResource.allocate(1), nullptr);
+
+  memoryResource.rewind(mark);
+  EXPECT_EQ(memoryResource.getUsedBytes(), mark);
+  EXPECT_EQ(memoryResource.allocate(capacity - 2), secondAllocation);
+
+  memoryResource.rewind(0);
+  EXPECT_EQ(memoryResource.allocate(2), firstAllocation);
+}
+
+TEST(BumpMemoryResource, DefaultConstructed) {
+  pando::BumpMemoryResource<1> memoryResource;
+  EXPECT_EQ(memoryResource.allocate(1), nullptr);
+  EXPECT_EQ(memoryResource.getUsedBytes(), 0u);
+}
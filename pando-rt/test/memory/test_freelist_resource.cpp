@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 /* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
 
+#include <algorithm>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -95,3 +96,171 @@ TEST(FreeListMemoryResource, ExhaustAndFail) {
   auto p = resource.allocate(8);
   EXPECT_EQ(p, nullptr);
 }
+
+TEST(FreeListMemoryResource, LargerSizeClass) {
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize();
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  std::size_t size = 1000;
+  resource.deallocate(buffer, size);
+
+  EXPECT_EQ(resource.allocate(2000), nullptr);
+  EXPECT_EQ(resource.allocate(100), buffer);
+  EXPECT_EQ(resource.allocate(100), nullptr);
+}
+
+TEST(FreeListMemoryResource, CacheableSize) {
+  EXPECT_FALSE(pando::FreeListMemoryResource::isCacheableSize(128));
+  EXPECT_FALSE(pando::FreeListMemoryResource::isCacheableSize(300));
+  EXPECT_TRUE(pando::FreeListMemoryResource::isCacheableSize(256));
+  EXPECT_TRUE(pando::FreeListMemoryResource::isCacheableSize(320));
+  EXPECT_TRUE(pando::FreeListMemoryResource::isCacheableSize(65536));
+  EXPECT_TRUE(pando::FreeListMemoryResource::isCacheableSize(114688));
+  EXPECT_FALSE(pando::FreeListMemoryResource::isCacheableSize(131072));
+
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(64), 64);
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(300), 320);
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(511), 512);
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(65537), 81920);
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(120000), 120000);
+  EXPECT_EQ(pando::FreeListMemoryResource::roundToCacheableSize(200000), 200000);
+
+  // the rounded size is less than 25% larger than the request
+  for (std::size_t bytes = 256; bytes <= 114688; bytes += 7) {
+    const auto rounded = pando::FreeListMemoryResource::roundToCacheableSize(bytes);
+    EXPECT_TRUE(pando::FreeListMemoryResource::isCacheableSize(rounded));
+    EXPECT_GE(rounded, bytes);
+    EXPECT_LT(rounded - bytes, bytes / 4);
+  }
+}
+
+TEST(FreeListMemoryResource, CachedSizesOfOneClass) {
+  const std::size_t numCaches = 1;
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize(numCaches);
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize, numCaches);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  // 1024 and 1280 share a size class but are cached separately
+  resource.deallocateCached(0, buffer, 1024);
+  EXPECT_EQ(resource.allocateCached(0, 1280), nullptr);
+  EXPECT_EQ(resource.allocateCached(0, 1024), buffer);
+}
+
+TEST(FreeListMemoryResource, CachedAllocate) {
+  const std::size_t numCaches = 2;
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize(numCaches);
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize, numCaches);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  std::size_t size = 256;
+  EXPECT_EQ(resource.allocateCached(0, size), nullptr);
+
+  resource.deallocateCached(0, buffer, size);
+  // blocks in a cache are only visible to its owner
+  EXPECT_EQ(resource.allocateCached(1, size), nullptr);
+  EXPECT_EQ(resource.allocate(size), nullptr);
+  EXPECT_EQ(resource.allocateCached(0, size), buffer);
+  EXPECT_EQ(resource.allocateCached(0, size), nullptr);
+}
+
+TEST(FreeListMemoryResource, CacheRefill) {
+  const std::size_t numCaches = 1;
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize(numCaches);
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize, numCaches);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  std::size_t size = 512;
+  std::vector<pando::GlobalPtr<std::byte>> allocations;
+  for (std::size_t i = 0; i < 3; i++) {
+    allocations.push_back(buffer);
+    resource.deallocate(buffer, size);
+    buffer = alignedBumpPointer(buffer, size);
+  }
+  // blocks of a different size are not moved to the cache
+  resource.deallocate(buffer, size + 8);
+
+  std::vector<pando::GlobalPtr<std::byte>> cached;
+  for (std::size_t i = 0; i < allocations.size(); i++) {
+    auto p = resource.allocateCached(0, size);
+    EXPECT_NE(p, nullptr);
+    cached.push_back(static_cast<pando::GlobalPtr<std::byte>>(p));
+  }
+  EXPECT_EQ(resource.allocateCached(0, size), nullptr);
+  EXPECT_TRUE(std::is_permutation(cached.begin(), cached.end(), allocations.begin()));
+
+  EXPECT_EQ(resource.allocate(size), buffer);
+}
+
+TEST(FreeListMemoryResource, CacheOverflow) {
+  const std::size_t numCaches = 1;
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize(numCaches);
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize, numCaches);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  std::size_t size = 1024;
+  const std::size_t numBlocks = 64;
+  for (std::size_t i = 0; i < numBlocks; i++) {
+    resource.deallocateCached(0, buffer, size);
+    buffer = alignedBumpPointer(buffer, size);
+  }
+
+  // excess blocks are returned to the shared lists
+  std::size_t numShared = 0;
+  while (resource.allocate(size) != nullptr) {
+    numShared++;
+  }
+  EXPECT_GT(numShared, 0);
+
+  std::size_t numCached = 0;
+  while (resource.allocateCached(0, size) != nullptr) {
+    numCached++;
+  }
+  EXPECT_GT(numCached, 0);
+  EXPECT_EQ(numShared + numCached, numBlocks);
+}
+
+TEST(FreeListMemoryResource, FlushCaches) {
+  const std::size_t numCaches = 3;
+  std::size_t metaDataSize = pando::FreeListMemoryResource::computeMetadataSize(numCaches);
+  pando::GlobalPtr<std::byte> buffer = getMainMemoryStart();
+  pando::FreeListMemoryResource resource(buffer, metaDataSize, numCaches);
+  buffer = alignedBumpPointer(buffer, metaDataSize);
+
+  // the first two caches hold blocks of two sizes, below their overflow threshold
+  const std::vector<std::size_t> sizes{512, 2048};
+  const std::size_t numBlocksPerSize = 4;
+  std::vector<pando::GlobalPtr<std::byte>> allocations;
+  for (std::size_t cacheIndex = 0; cacheIndex < numCaches - 1; cacheIndex++) {
+    for (const auto size : sizes) {
+      for (std::size_t i = 0; i < numBlocksPerSize; i++) {
+        allocations.push_back(buffer);
+        resource.deallocateCached(cacheIndex, buffer, size);
+        buffer = alignedBumpPointer(buffer, size);
+      }
+    }
+  }
+  for (const auto size : sizes) {
+    EXPECT_EQ(resource.allocate(size), nullptr);
+    EXPECT_EQ(resource.allocateCached(numCaches - 1, size), nullptr);
+  }
+
+  EXPECT_EQ(resource.flushCaches(), allocations.size());
+  EXPECT_EQ(resource.flushCaches(), 0);
+
+  // the blocks can now be allocated from the last cache
+  std::vector<pando::GlobalPtr<std::byte>> reclaimed;
+  for (const auto size : sizes) {
+    for (auto p = resource.allocateCached(numCaches - 1, size); p != nullptr;
+         p = resource.allocateCached(numCaches - 1, size)) {
+      reclaimed.push_back(static_cast<pando::GlobalPtr<std::byte>>(p));
+    }
+  }
+  EXPECT_TRUE(std::is_permutation(reclaimed.begin(), reclaimed.end(), allocations.begin(),
+                                  allocations.end()));
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+/* Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved. */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "pando-rt/memory/translation_cache.hpp"
+
+#include "pando-rt/locality.hpp"
+#include "pando-rt/memory/global_ptr.hpp"
+#include "pando-rt/memory_resource.hpp"
+
+TEST(TranslationCache, Empty) {
+  pando::detail::TranslationCache cache;
+  EXPECT_EQ(cache.find(0), nullptr);
+  EXPECT_EQ(cache.find(0x1000), nullptr);
+}
+
+TEST(TranslationCache, FindInRange) {
+  std::byte buffer[64];
+  pando::detail::TranslationCache cache;
+  cache.insert(0x1000, buffer, sizeof(buffer));
+  EXPECT_EQ(cache.find(0x1000), &buffer[0]);
+  EXPECT_EQ(cache.find(0x1010), &buffer[16]);
+  EXPECT_EQ(cache.find(0x103f), &buffer[63]);
+  EXPECT_EQ(cache.find(0x1040), nullptr);
+  EXPECT_EQ(cache.find(0x0fff), nullptr);
+}
+
+TEST(TranslationCache, FindRemainingSize) {
+  std::byte buffer[64];
+  pando::detail::TranslationCache cache;
+  cache.insert(0x1000, buffer, sizeof(buffer));
+  std::size_t size = 0;
+  EXPECT_EQ(cache.find(0x1000, size), &buffer[0]);
+  EXPECT_EQ(size, 64);
+  EXPECT_EQ(cache.find(0x1030, size), &buffer[48]);
+  EXPECT_EQ(size, 16);
+  EXPECT_EQ(cache.find(0x1040, size), nullptr);
+  EXPECT_EQ(size, 0);
+}
+
+TEST(TranslationCache, ReplaceOldest) {
+  std::byte buffer[64];
+  pando::detail::TranslationCache cache;
+  for (std::uint64_t i = 0; i < 8; ++i) {
+    cache.insert(0x1000 * (i + 1), buffer, sizeof(buffer));
+  }
+  EXPECT_EQ(cache.find(0x1000), &buffer[0]);
+  cache.insert(0x10000, buffer, sizeof(buffer));
+  EXPECT_EQ(cache.find(0x1000), nullptr);
+  EXPECT_EQ(cache.find(0x2000), &buffer[0]);
+  EXPECT_EQ(cache.find(0x10000), &buffer[0]);
+}
+
+TEST(TranslationCache, Clear) {
+  std::byte buffer[64];
+  pando::detail::TranslationCache cache;
+  cache.insert(0x1000, buffer, sizeof(buffer));
+  cache.clear();
+  EXPECT_EQ(cache.find(0x1000), nullptr);
+}
+
+#if defined(PANDO_RT_USE_BACKEND_PREP)
+
+TEST(TranslationCache, LocalMainMemory) {
+  const std::size_t size = sizeof(std::uint64_t);
+  auto resource = pando::getDefaultMainMemoryResource();
+  pando::GlobalPtr<std::uint64_t> ptr =
+      static_cast<pando::GlobalPtr<std::uint64_t>>(resource->allocate(size));
+  ASSERT_NE(ptr, nullptr);
+
+  auto nativePtr = pando::detail::localMainToNative(ptr.address);
+  ASSERT_NE(nativePtr, nullptr);
+  EXPECT_EQ(nativePtr, pando::detail::asNativePtr(ptr.address));
+  EXPECT_EQ(pando::detail::localMainToGlobal(nativePtr), ptr.address);
+  EXPECT_EQ(pando::GlobalPtr<std::uint64_t>(static_cast<std::uint64_t*>(nativePtr)), ptr);
+
+  *ptr = 42;
+  EXPECT_EQ(*static_cast<std::uint64_t*>(nativePtr), 42u);
+
+  resource->deallocate(ptr, size);
+}
+
+TEST(TranslationCache, LocalL2SPMemory) {
+  const std::size_t size = sizeof(std::uint64_t);
+  auto resource = pando::getDefaultL2SPResource();
+  pando::GlobalPtr<std::uint64_t> ptr =
+      static_cast<pando::GlobalPtr<std::uint64_t>>(resource->allocate(size));
+  ASSERT_NE(ptr, nullptr);
+
+  auto nativePtr = pando::detail::localToNative(ptr.address);
+  ASSERT_NE(nativePtr, nullptr);
+  EXPECT_EQ(nativePtr, pando::detail::localL2SPToNative(ptr.address));
+  EXPECT_EQ(nativePtr, pando::detail::asNativePtr(ptr.address));
+  EXPECT_EQ(pando::detail::localMainToNative(ptr.address), nullptr);
+
+  resource->deallocate(ptr, size);
+}
+
+TEST(TranslationCache, TypedLoadStore) {
+  const std::size_t size = sizeof(std::uint64_t);
+  auto resource = pando::getDefaultMainMemoryResource();
+  pando::GlobalPtr<std::uint64_t> ptr =
+      static_cast<pando::GlobalPtr<std::uint64_t>>(resource->allocate(size));
+  ASSERT_NE(ptr, nullptr);
+
+  const std::uint64_t value = 0x0123456789abcdef;
+  pando::detail::store<std::uint64_t>(ptr.address, &value);
+  std::uint64_t result = 0;
+  pando::detail::load<std::uint64_t>(ptr.address, &result);
+  EXPECT_EQ(result, value);
+  EXPECT_EQ(*ptr, value);
+
+  resource->deallocate(ptr, size);
+}
+
+TEST(TranslationCache, NotLocalMainMemory) {
+  std::uint64_t value = 0;
+  EXPECT_EQ(pando::detail::localMainToGlobal(&value), pando::GlobalAddress{});
+  EXPECT_EQ(pando::detail::localMainToGlobal(nullptr), pando::GlobalAddress{});
+  EXPECT_EQ(pando::detail::localMainToNative(pando::GlobalAddress{}), nullptr);
+  const auto l1SPAddr = pando::encodeL1SPAddress(pando::getCurrentNode(), pando::PodIndex{0, 0},
+                                                 pando::CoreIndex{0, 0}, 0);
+  EXPECT_EQ(pando::detail::localMainToNative(l1SPAddr), nullptr);
+  EXPECT_EQ(pando::detail::localToNative(l1SPAddr), nullptr);
+}
+
+#endif // PANDO_RT_USE_BACKEND_PREP
@@ -180,3 +180,91 @@ TYPED_TEST(AtomicsTest, ValueBasedFetchSub) {
   const auto result = pando::executeOnWait(place, +test, this->ptr);
   EXPECT_TRUE(result.hasValue());
 }
+
+TYPED_TEST(AtomicsTest, ValueBasedFetchMin) {
+  using ValueType = typename TestFixture::ValueType;
+  using GlobalPtrType = pando::GlobalPtr<ValueType>;
+
+  auto test = [](GlobalPtrType ptr) {
+    ValueType oldExpected{32};
+    ValueType larger{40};
+    ValueType smaller{5};
+    *ptr = oldExpected;
+    const auto order = std::memory_order_relaxed;
+
+    EXPECT_EQ(pando::atomicFetchMin(ptr, larger, order), oldExpected);
+    EXPECT_EQ(*ptr, oldExpected);
+    EXPECT_EQ(pando::atomicFetchMin(ptr, smaller, order), oldExpected);
+    EXPECT_EQ(*ptr, smaller);
+  };
+
+  const auto thisPlace = pando::getCurrentPlace();
+  const auto place = pando::Place{thisPlace.node, pando::anyPod, pando::anyCore};
+  const auto result = pando::executeOnWait(place, +test, this->ptr);
+  EXPECT_TRUE(result.hasValue());
+}
+
+TYPED_TEST(AtomicsTest, ValueBasedFetchMax) {
+  using ValueType = typename TestFixture::ValueType;
+  using GlobalPtrType = pando::GlobalPtr<ValueType>;
+
+  auto test = [](GlobalPtrType ptr) {
+    ValueType oldExpected{32};
+    ValueType larger{40};
+    ValueType smaller{5};
+    *ptr = oldExpected;
+    const auto order = std::memory_order_relaxed;
+
+    EXPECT_EQ(pando::atomicFetchMax(ptr, smaller, order), oldExpected);
+    EXPECT_EQ(*ptr, oldExpected);
+    EXPECT_EQ(pando::atomicFetchMax(ptr, larger, order), oldExpected);
+    EXPECT_EQ(*ptr, larger);
+  };
+
+  const auto thisPlace = pando::getCurrentPlace();
+  const auto place = pando::Place{thisPlace.node, pando::anyPod, pando::anyCore};
+  const auto result = pando::executeOnWait(place, +test, this->ptr);
+  EXPECT_TRUE(result.hasValue());
+}
+
+TYPED_TEST(AtomicsTest, ValueBasedFetchOr) {
+  using ValueType = typename TestFixture::ValueType;
+  using GlobalPtrType = pando::GlobalPtr<ValueType>;
+
+  auto test = [](GlobalPtrType ptr) {
+    ValueType oldExpected{0b1010};
+    ValueType toOr{0b0110};
+    *ptr = oldExpected;
+    const auto order = std::memory_order_relaxed;
+    const auto oldFound = pando::atomicFetchOr(ptr, toOr, order);
+
+    EXPECT_EQ(oldFound, oldExpected);
+    EXPECT_EQ(*ptr, ValueType{0b1110});
+  };
+
+  const auto thisPlace = pando::getCurrentPlace();
+  const auto place = pando::Place{thisPlace.node, pando::anyPod, pando::anyCore};
+  const auto result = pando::executeOnWait(place, +test, this->ptr);
+  EXPECT_TRUE(result.hasValue());
+}
+
+TYPED_TEST(AtomicsTest, ValueBasedFetchAnd) {
+  using ValueType = typename TestFixture::ValueType;
+  using GlobalPtrType = pando::GlobalPtr<ValueType>;
+
+  auto test = [](GlobalPtrType ptr) {
+    ValueType oldExpected{0b1010};
+    ValueType toAnd{0b0110};
+    *ptr = oldExpected;
+    const auto order = std::memory_order_relaxed;
+    const auto oldFound = pando::atomicFetchAnd(ptr, toAnd, order);
+
+    EXPECT_EQ(oldFound, oldExpected);
+    EXPECT_EQ(*ptr, ValueType{0b0010});
+  };
+
+  const auto thisPlace = pando::getCurrentPlace();
+  const auto place = pando::Place{thisPlace.node, pando::anyPod, pando::anyCore};
+  const auto result = pando::executeOnWait(place, +test, this->ptr);
+  EXPECT_TRUE(result.hasValue());
+}
@@ -3,11 +3,75 @@
 
 import sys
 import os
+import struct
+from collections import Counter
+
+#####   Binary memory trace files (PANDO_TRACING_MEM_FORMAT=binary)   #####
+TRACE_RECORD = struct.Struct("<QQIHHBB6x")
+TRACE_MEM_TYPES = {0: "L1SP", 1: "L2SP", 2: "MAIN"}
+TRACE_NO_MEM_TYPE = 0xff
+
+def read_trace(filename):
+    """Yields (timestamp, op, memType, source, dest, size, globalAddress) for every record."""
+    with open(filename, "rb") as file:
+        magic = file.read(4)
+        if magic != b"PMTR":
+            raise ValueError(filename + " is not a PANDO memory trace file")
+        version, node, num_ops = struct.unpack("<III", file.read(12))
+        if version != 2:
+            raise ValueError("unsupported memory trace version " + str(version))
+        # the op names are stored in the file, so records are decoded without a name table here
+        ops = []
+        for _ in range(num_ops):
+            (length,) = struct.unpack("<B", file.read(1))
+            ops.append(file.read(length).decode())
+
+        while True:
+            block = file.read(TRACE_RECORD.size * 4096)
+            if not block:
+                break
+            for record in TRACE_RECORD.iter_unpack(block[:len(block) - len(block) % TRACE_RECORD.size]):
+                timestamp, address, size, source, dest, op, mem_type = record
+                mem_type_name = None if mem_type == TRACE_NO_MEM_TYPE else TRACE_MEM_TYPES.get(mem_type, "Unknown")
+                yield timestamp, ops[op], mem_type_name, source, dest, size, address
+
+def format_trace_record(record):
+    """Formats a record like the text memory trace, without the payload."""
+    _, op, mem_type, source, dest, size, address = record
+    if mem_type is None:
+        if op == "FUNC":
+            return "[MEM] {} {}-{} {}".format(op, source, dest, size)
+        return "[MEM] {} {}-{}".format(op, source, dest)
+    return "[MEM] {} {} {}-{} {} {:x}".format(op, mem_type, source, dest, size, address)
+
+def decode_trace(mode, filename):
+    if mode == "text":
+        for record in read_trace(filename):
+            print(format_trace_record(record))
+    else:
+        counts = Counter()
+        total_bytes = Counter()
+        for record in read_trace(filename):
+            key = (record[1], record[3], record[4])
+            counts[key] += 1
+            total_bytes[key] += record[5]
+        for (op, source, dest), count in sorted(counts.items()):
+            print("{} {}-{} (count): {}".format(op, source, dest, count))
+            print("{} {}-{} (bytes): {}".format(op, source, dest, total_bytes[(op, source, dest)]))
+
+if len(sys.argv) >= 2 and sys.argv[1] == "decode":
+    if len(sys.argv) != 4 or sys.argv[2] not in ("text", "count"):
+        print("usage: python3 trace_process.py decode (text / count) (binary trace file)")
+        sys.exit(1)
+    decode_trace(sys.argv[2], sys.argv[3])
+    sys.exit(0)
+
 import numpy as np
 import matplotlib.pyplot as plt
 
 if len(sys.argv) != 8:
     print("usage: python3 trace_process.py (application or workflow name) (number of hosts) (directory to the stat files) (per-phase / end-to-end) (include-local / remote-only) (load / store / rmw / func / reference) (stat-dump / plot-hist)")
+    print("       python3 trace_process.py decode (text / count) (binary trace file)")
     sys.exit(1)
 
 app = sys.argv[1]
@@ -163,6 +227,38 @@ for host_id in range(host):
             line_split = line.strip().split()
             byte = int(line_split[2])
             rmw_byte[host_id][phase_curr][src] += byte
+        elif line.find('ATOMIC_FETCH_MIN (count)') != -1:
+            line_split = line.strip().split()
+            count = int(line_split[2])
+            rmw_cnt[host_id][phase_curr][src] += count
+        elif line.find('ATOMIC_FETCH_MIN (bytes)') != -1:
+            line_split = line.strip().split()
+            byte = int(line_split[2])
+            rmw_byte[host_id][phase_curr][src] += byte
+        elif line.find('ATOMIC_FETCH_MAX (count)') != -1:
+            line_split = line.strip().split()
+            count = int(line_split[2])
+            rmw_cnt[host_id][phase_curr][src] += count
+        elif line.find('ATOMIC_FETCH_MAX (bytes)') != -1:
+            line_split = line.strip().split()
+            byte = int(line_split[2])
+            rmw_byte[host_id][phase_curr][src] += byte
+        elif line.find('ATOMIC_FETCH_OR (count)') != -1:
+            line_split = line.strip().split()
+            count = int(line_split[2])
+            rmw_cnt[host_id][phase_curr][src] += count
+        elif line.find('ATOMIC_FETCH_OR (bytes)') != -1:
+            line_split = line.strip().split()
+            byte = int(line_split[2])
+            rmw_byte[host_id][phase_curr][src] += byte
+        elif line.find('ATOMIC_FETCH_AND (count)') != -1:
+            line_split = line.strip().split()
+            count = int(line_split[2])
+            rmw_cnt[host_id][phase_curr][src] += count
+        elif line.find('ATOMIC_FETCH_AND (bytes)') != -1:
+            line_split = line.strip().split()
+            byte = int(line_split[2])
+            rmw_byte[host_id][phase_curr][src] += byte
         elif line.find('LOAD (count)') != -1:
             line_split = line.strip().split()
             count = int(line_split[2])
@@ -91,6 +91,7 @@ ${DBG} sst -n ${HOST_THREADS} \
     --pxn-dram-size=${MAIN_MEMORY_SIZE} \
     --perf-stats \
     --stats-load-level=5 \
+    --phase-stats \
     --stats-preallocated-phase=64 \
     ${PROG} $@
 comment
@@ -280,3 +280,105 @@ void launch_edge_exchange(
   for (int64_t i = 0; i < num_hosts; i++)
     dones[i] = false;
 }
+
+// Copies the edges of a vhost into the final edge list of a host, EDGE_EXCHANGE_BATCH_SIZE edges
+// per transfer
+void copy_vhost_edges(galois::WaitGroup::HandleType wgh, EdgeVectorPando src_edges,
+                      pando::GlobalPtr<Edge> dest) {
+  for (size_t i = 0; i < src_edges.size(); i += EDGE_EXCHANGE_BATCH_SIZE) {
+    size_t batch = std::min(EDGE_EXCHANGE_BATCH_SIZE, src_edges.size() - i);
+    pando::detail::bulkMemcpy((src_edges.data() + i).address, sizeof(Edge) * batch,
+                              (dest + i).address);
+  }
+  wgh.done();
+}
+
+// KERNEL: Per host
+void stream_edges(pando::GlobalPtr<bool> done, pando::GlobalPtr<bool> ready,
+                  pando::GlobalPtr<int64_t> offsets,
+                  pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host,
+                  pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host,
+                  pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost,
+                  int64_t num_vhosts_per_host) {
+  int64_t my_host_id = pando::getCurrentPlace().node.id;
+  int64_t num_hosts = pando::getPlaceDims().node.id;
+
+  // Size the final edge list, with the edges of each host starting at its offset
+  pando::Vector<int64_t> my_vhosts = vhosts_per_host[my_host_id];
+  int64_t num_edges = 0;
+  for (int64_t h = 0; h < num_hosts; h++) {
+    offsets[my_host_id * num_hosts + h] = num_edges;
+    for (size_t j = 0; j < my_vhosts.size(); j++) {
+      EdgeVectorPando edge_vector =
+          global_vhostEdgesPerHost[h * num_vhosts_per_host + my_vhosts[j]];
+      num_edges += edge_vector.size();
+    }
+  }
+  EdgeVectorPando my_edges = final_edgelist_per_host[my_host_id];
+  PANDO_CHECK(my_edges.initialize(num_edges));
+  final_edgelist_per_host[my_host_id] = std::move(my_edges);
+  ready[my_host_id] = true;
+
+  // Send to each host, starting with the next host so that hosts do not all send to the same one at
+  // once. Each vhost is copied by its own task, so the transfers of a host overlap.
+  galois::WaitGroup wg;
+  PANDO_CHECK(wg.initialize(0));
+  auto wgh = wg.getHandle();
+  const pando::Place here{pando::NodeIndex{my_host_id}, pando::anyPod, pando::anyCore};
+  for (int64_t k = 0; k < num_hosts; k++) {
+    int64_t h = (my_host_id + k) % num_hosts;
+    pando::waitUntil([ready, h]() {
+      return ready[h];
+    });
+    EdgeVectorPando dest_edges = final_edgelist_per_host[h];
+    int64_t offset = offsets[h * num_hosts + my_host_id];
+    pando::Vector<int64_t> vhosts_hostH = vhosts_per_host[h];
+    for (size_t j = 0; j < vhosts_hostH.size(); j++) {
+      int64_t flat_indx = (my_host_id * num_vhosts_per_host) + vhosts_hostH[j];
+      EdgeVectorPando src_edges = global_vhostEdgesPerHost[flat_indx];
+      if (src_edges.size() == 0) {
+        continue;
+      }
+      wgh.addOne();
+      PANDO_CHECK(
+          executeOn(here, &copy_vhost_edges, wgh, src_edges, dest_edges.data() + offset));
+      offset += src_edges.size();
+    }
+  }
+  PANDO_CHECK(wg.wait());
+  wg.deinitialize();
+
+  *done = true;
+}
+
+void launch_stream_edge_exchange(pando::GlobalPtr<bool> dones,
+                                 pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host,
+                                 pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host,
+                                 pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost,
+                                 int64_t num_vhosts_per_host) {
+  auto num_hosts = pando::getPlaceDims().node.id;
+  pando::GlobalPtr<bool> ready = static_cast<pando::GlobalPtr<bool>>(
+      pando::getDefaultMainMemoryResource()->allocate(sizeof(bool) * num_hosts));
+  pando::GlobalPtr<int64_t> offsets = static_cast<pando::GlobalPtr<int64_t>>(
+      pando::getDefaultMainMemoryResource()->allocate(sizeof(int64_t) * num_hosts * num_hosts));
+  for (int64_t i = 0; i < num_hosts; i++)
+    ready[i] = false;
+
+  // LAUNCH KERNEL:: stream_edges
+  for (int64_t i = 0; i < num_hosts; i++) {
+    PANDO_CHECK(executeOn(pando::Place{pando::NodeIndex{i}, pando::anyPod, pando::anyCore},
+                          &stream_edges, &dones[i], ready, offsets, final_edgelist_per_host,
+                          vhosts_per_host, global_vhostEdgesPerHost, num_vhosts_per_host));
+  }
+  for (int64_t i = 0; i < num_hosts; i++)
+    pando::waitUntil([dones, i]() {
+      return dones[i];
+    });
+
+  // Reset dones
+  for (int64_t i = 0; i < num_hosts; i++)
+    dones[i] = false;
+
+  pando::deallocateMemory(ready, num_hosts);
+  pando::deallocateMemory(offsets, num_hosts * num_hosts);
+}
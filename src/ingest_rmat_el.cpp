@@ -67,6 +67,15 @@ pando::Status galois::generateEdgesPerVirtualHost(
   return pando::Status::Success;
 }
 
+pando::Status galois::generateVerticesInRange(pando::GlobalRef<pando::Vector<ELVertex>> vertices,
+                                              std::uint64_t begin, std::uint64_t end) {
+  PANDO_CHECK_RETURN(fmap(vertices, reserve, lift(vertices, size) + (end - begin)));
+  for (std::uint64_t i = begin; i < end; i++) {
+    PANDO_CHECK_RETURN(fmap(vertices, pushBack, ELVertex{i}));
+  }
+  return pando::Status::Success;
+}
+
 pando::Vector<pando::Vector<galois::ELEdge>> galois::reduceLocalEdges(
     galois::ThreadLocalVector<pando::Vector<galois::ELEdge>> localEdges, uint64_t numVertices) {
   pando::Vector<pando::Vector<galois::ELEdge>> reducedEL;
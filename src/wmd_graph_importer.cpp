@@ -5,11 +5,71 @@
 
 #include <pando-lib-galois/containers/host_indexed_map.hpp>
 
+namespace {
+
+// Cuts the virtual hosts, in the order of their ids, into one contiguous range per physical host.
+// A host takes virtual hosts until the prefix sum of the edges reaches the end of its share of all
+// edges, and keeps at least one virtual host as long as there are enough for the hosts after it.
 [[nodiscard]] pando::Expected<
     galois::Pair<pando::Array<std::uint64_t>, galois::HostIndexedMap<std::uint64_t>>>
-galois::internal::buildVirtualToPhysicalMapping(
+buildEdgeBalancedRanges(
     std::uint64_t numHosts,
     pando::Array<galois::Pair<std::uint64_t, std::uint64_t>> labeledVirtualCounts) {
+  const std::uint64_t numVirtualHosts = labeledVirtualCounts.size();
+
+  pando::Array<std::uint64_t> counts;
+  PANDO_CHECK_RETURN(counts.initialize(numVirtualHosts));
+  std::uint64_t totalEdges = 0;
+  for (galois::Pair<std::uint64_t, std::uint64_t> virtualPair : labeledVirtualCounts) {
+    counts[virtualPair.second] = virtualPair.first;
+    totalEdges += virtualPair.first;
+  }
+  // without edges, balance the number of virtual hosts instead
+  const bool countEdges = totalEdges != 0;
+  const std::uint64_t total = countEdges ? totalEdges : numVirtualHosts;
+
+  pando::Array<std::uint64_t> vTPH;
+  PANDO_CHECK_RETURN(vTPH.initialize(numVirtualHosts));
+
+  galois::HostIndexedMap<std::uint64_t> numEdges{};
+  PANDO_CHECK_RETURN(numEdges.initialize());
+  for (std::uint64_t i = 0; i < numHosts; i++) {
+    numEdges[i] = 0;
+  }
+
+  std::uint64_t host = 0;
+  std::uint64_t hostVirtualHosts = 0;
+  std::uint64_t prefix = 0;
+  for (std::uint64_t i = 0; i < numVirtualHosts; i++) {
+    const bool shareDone = prefix * numHosts >= (host + 1) * total;
+    const bool neededLater = numVirtualHosts - i <= numHosts - 1 - host;
+    if (host + 1 < numHosts && hostVirtualHosts != 0 && (shareDone || neededLater)) {
+      host++;
+      hostVirtualHosts = 0;
+    }
+    const std::uint64_t count = counts[i];
+    vTPH[i] = host;
+    numEdges[host] = numEdges[host] + count;
+    prefix += countEdges ? count : 1;
+    hostVirtualHosts++;
+  }
+
+  counts.deinitialize();
+  return galois::make_tpl(vTPH, numEdges);
+}
+
+} // namespace
+
+[[nodiscard]] pando::Expected<
+    galois::Pair<pando::Array<std::uint64_t>, galois::HostIndexedMap<std::uint64_t>>>
+galois::internal::buildVirtualToPhysicalMapping(
+    std::uint64_t numHosts,
+    pando::Array<galois::Pair<std::uint64_t, std::uint64_t>> labeledVirtualCounts,
+    VirtualHostPolicy policy) {
+  if (policy == VirtualHostPolicy::EdgeBalancedRanges) {
+    return buildEdgeBalancedRanges(numHosts, labeledVirtualCounts);
+  }
+
   std::sort(labeledVirtualCounts.begin(), labeledVirtualCounts.end());
 
   pando::Array<std::uint64_t> vTPH;
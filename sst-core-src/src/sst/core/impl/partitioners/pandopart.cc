@@ -0,0 +1,273 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/pandopart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <cassert>
+#include <cctype>
+#include <cinttypes>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace SST::IMPL::Partition;
+
+namespace {
+
+// Components that are placed together
+struct Unit
+{
+    double                             weight = 0;
+    std::vector<SST::ConfigComponent*> comps;
+
+    void add(SST::ConfigComponent* comp)
+    {
+        weight += comp->weight;
+        comps.push_back(comp);
+    }
+};
+
+// PXN and pod of a component, or -1 if unknown
+struct Label
+{
+    int  pxn;
+    int  pod;
+    // Shared by the whole PXN, so the pod is never taken from neighbors
+    bool shared;
+};
+
+// Returns whether the component is shared by its whole PXN even if its
+// name carries a pod, e.g. "mainmem_pxn1_pod0_memctrl_2" is a main memory
+// bank of PXN 1 and every pod of it reaches it through the PXN crossbar
+bool
+isPxnShared(const std::string& name)
+{
+    return name.compare(0, 7, "mainmem") == 0;
+}
+
+// Returns the index that follows tag in name, e.g. 3 for "pod" in
+// "core_0_pod3_pxn1" or 1 for "pxn" in "offchiprtr_bridge_pxn_1",
+// otherwise -1
+int
+parseIndex(const std::string& name, const std::string& tag)
+{
+    size_t pos = 0;
+    while ( (pos = name.find(tag, pos)) != std::string::npos ) {
+        size_t start = pos + tag.size();
+        if ( start < name.size() && name[start] == '_' ) start++;
+        size_t end = start;
+        while ( end < name.size() && isdigit(static_cast<unsigned char>(name[end])) )
+            end++;
+        if ( end > start ) return std::stoi(name.substr(start, end - start));
+        pos = start;
+    }
+    return -1;
+}
+
+// Returns the value all labeled neighbors agree on, otherwise -1
+template <typename F>
+int
+agreedLabel(const std::vector<SST::ComponentId_t>& neighbors, F label)
+{
+    int agreed = -1;
+    for ( auto id : neighbors ) {
+        int value = label(id);
+        if ( value < 0 ) continue;
+        if ( agreed >= 0 && agreed != value ) return -1;
+        agreed = value;
+    }
+    return agreed;
+}
+
+// Assigns units in order to contiguous parts [first, first + count) so
+// that every part gets about the same weight
+void
+assignContiguous(const std::vector<Unit*>& units, uint32_t first, uint32_t count, std::vector<uint32_t>& parts)
+{
+    double total = 0;
+    for ( auto unit : units )
+        total += unit->weight;
+
+    double before = 0;
+    for ( size_t i = 0; i < units.size(); i++ ) {
+        // Place every unit by the middle of its weight, or by its index
+        // when there are no weights
+        uint32_t part = total > 0 ? static_cast<uint32_t>((before + units[i]->weight / 2) * count / total)
+                                  : static_cast<uint32_t>(i * count / units.size());
+        if ( part >= count ) part = count - 1;
+        parts.push_back(first + part);
+        before += units[i]->weight;
+    }
+}
+
+} // namespace
+
+SSTPandoPartition::SSTPandoPartition(RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity)
+{
+    rankcount  = mpiranks;
+    partOutput = new Output("PandoPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+void
+SSTPandoPartition::performPartition(ConfigGraph* graph)
+{
+    assert(rankcount.rank > 0);
+
+    ConfigComponentMap_t& compMap = graph->getComponentMap();
+    ConfigLinkMap_t&      linkMap = graph->getLinkMap();
+
+    const uint32_t tot_ranks = rankcount.rank * rankcount.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a PANDO partition scheme for simulation model.\n");
+
+    // Label the components from their names and find their neighbors
+    std::map<ComponentId_t, Label>                      labels;
+    std::map<ComponentId_t, std::vector<ComponentId_t>> neighbors;
+    for ( auto comp : compMap ) {
+        const bool shared = isPxnShared(comp->name);
+        labels[comp->id]  = Label { parseIndex(comp->name, "pxn"), shared ? -1 : parseIndex(comp->name, "pod"), shared };
+        auto& adjacent   = neighbors[comp->id];
+        for ( LinkId_t link_id : comp->allLinks() ) {
+            const ConfigLink* link = linkMap[link_id];
+            for ( int i = 0; i < 2; i++ ) {
+                ComponentId_t other = COMPONENT_ID_MASK(link->component[i]);
+                if ( other != comp->id ) adjacent.push_back(other);
+            }
+        }
+    }
+
+    // Label the other components from their neighbors
+    bool changed = true;
+    while ( changed ) {
+        changed = false;
+        for ( auto comp : compMap ) {
+            Label& label = labels[comp->id];
+            if ( label.pxn < 0 ) {
+                label.pxn = agreedLabel(neighbors[comp->id], [&](ComponentId_t id) { return labels[id].pxn; });
+                changed |= label.pxn >= 0;
+            }
+            if ( label.pxn >= 0 && label.pod < 0 && !label.shared ) {
+                label.pod = agreedLabel(neighbors[comp->id], [&](ComponentId_t id) {
+                    return labels[id].pxn == label.pxn ? labels[id].pod : -1;
+                });
+                changed |= label.pod >= 0;
+            }
+        }
+    }
+
+    // Group the components into the network, the shared part of each
+    // PXN and the pods of each PXN
+    Unit                               network;
+    std::map<int, Unit>                pxn_shared;
+    std::map<int, std::map<int, Unit>> pxn_pods;
+    for ( auto comp : compMap ) {
+        const Label& label = labels[comp->id];
+        if ( label.pxn < 0 ) { network.add(comp); }
+        else if ( label.pod < 0 ) {
+            pxn_shared[label.pxn].add(comp);
+        }
+        else {
+            pxn_pods[label.pxn][label.pod].add(comp);
+        }
+    }
+    std::set<int> pxns;
+    for ( auto& entry : pxn_shared )
+        pxns.insert(entry.first);
+    for ( auto& entry : pxn_pods )
+        pxns.insert(entry.first);
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", graph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- PXN Count:                        %10zu\n", pxns.size());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Network Components:               %10zu\n", network.comps.size());
+
+    // Units in order and the part of each one
+    std::vector<Unit*>    units;
+    std::vector<uint32_t> parts;
+    std::vector<Unit>     merged;
+    if ( pxns.empty() ) {
+        // Not a PANDO model, so balance contiguous components
+        partOutput->verbose(CALL_INFO, 1, 0, "No PXN found, partitioning components linearly.\n");
+        merged.resize(graph->getNumComponents());
+        size_t i = 0;
+        for ( auto comp : compMap ) {
+            merged[i].add(comp);
+            units.push_back(&merged[i++]);
+        }
+        assignContiguous(units, 0, tot_ranks, parts);
+    }
+    else if ( tot_ranks <= pxns.size() ) {
+        // Keep every PXN whole
+        merged.resize(pxns.size());
+        size_t i = 0;
+        for ( int pxn : pxns ) {
+            for ( auto comp : pxn_shared[pxn].comps )
+                merged[i].add(comp);
+            for ( auto& pod : pxn_pods[pxn] ) {
+                for ( auto comp : pod.second.comps )
+                    merged[i].add(comp);
+            }
+            units.push_back(&merged[i++]);
+        }
+        assignContiguous(units, 0, tot_ranks, parts);
+        units.push_back(&network);
+        parts.push_back(0);
+    }
+    else {
+        // Give every PXN its share of the ranks and spread its pods over them
+        const uint32_t ranks_per_pxn = tot_ranks / pxns.size();
+        uint32_t       extra_ranks   = tot_ranks % pxns.size();
+        uint32_t       first         = 0;
+        for ( int pxn : pxns ) {
+            uint32_t count = ranks_per_pxn + (extra_ranks > 0 ? 1 : 0);
+            if ( extra_ranks > 0 ) extra_ranks--;
+            if ( pxn_pods[pxn].size() < count ) {
+                partOutput->verbose(
+                    CALL_INFO, 1, 0, "PXN %d has %zu pods for %" PRIu32 " ranks, some ranks will be empty.\n", pxn,
+                    pxn_pods[pxn].size(), count);
+            }
+
+            std::vector<Unit*> pxn_units;
+            pxn_units.push_back(&pxn_shared[pxn]);
+            for ( auto& pod : pxn_pods[pxn] )
+                pxn_units.push_back(&pod.second);
+            assignContiguous(pxn_units, first, count, parts);
+            units.insert(units.end(), pxn_units.begin(), pxn_units.end());
+            first += count;
+        }
+        units.push_back(&network);
+        parts.push_back(0);
+    }
+
+    // Apply the ranks
+    std::map<ComponentId_t, uint32_t> comp_parts;
+    for ( size_t i = 0; i < units.size(); i++ ) {
+        RankInfo rank(parts[i] / rankcount.thread, parts[i] % rankcount.thread);
+        for ( auto comp : units[i]->comps ) {
+            comp->setRank(rank);
+            comp_parts[comp->id] = parts[i];
+        }
+    }
+
+    size_t cut_links = 0;
+    for ( auto link : linkMap ) {
+        if ( comp_parts[COMPONENT_ID_MASK(link->component[0])] != comp_parts[COMPONENT_ID_MASK(link->component[1])] )
+            cut_links++;
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut Links:                        %10zu\n", cut_links);
+    partOutput->verbose(CALL_INFO, 1, 0, "PANDO partition scheme completed.\n");
+}
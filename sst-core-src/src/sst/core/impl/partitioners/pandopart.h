@@ -0,0 +1,82 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_PANDOPART_H
+#define SST_CORE_IMPL_PARTITONERS_PANDOPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitions a PANDO system model, such as the one built by PANDOHammerDrvX.py,
+along its PXN/pod hierarchy. Cores, scratchpads and routers exchange messages
+far more often than PXNs do, so the links between them should not cross ranks.
+
+The PXN and pod of a component are read from its name (e.g. "core_3_pod1_pxn0").
+A component without them in its name takes the PXN and pod that all its labeled
+neighbors agree on, so "chiprtr0" belongs to PXN 0 and the off-chip router
+belongs to no PXN. Main memory components ("mainmem*") are shared by their PXN
+even though the banks are named after pod 0.
+
+With at most as many ranks as PXNs, every PXN is kept whole and only the links
+to the off-chip network are cut. With more ranks than PXNs, every PXN gets its
+share of the ranks, and its pods are kept whole and spread over them, so only
+the links from pods to the PXN crossbar are cut as well. Both cases balance the
+component weights over the ranks.
+*/
+class SSTPandoPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTPandoPartition,
+        "sst",
+        "pando",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions PANDO models along the PXN/pod hierarchy read from component names, "
+        "so that only PXN-to-PXN network links are cut when possible.")
+
+protected:
+    /** Number of ranks in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+public:
+    /**
+       Creates a new PANDO partition scheme.
+       \param mpiRankCount Number of MPI ranks in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTPandoPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override { return true; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif
@@ -0,0 +1,275 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadderQueue.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace SST {
+namespace IMPL {
+
+// Heap order that keeps the earliest activity at the front
+static Activity::greater<true, true, true> heap_order;
+
+// Last time of the range of length times starting at start, saturated
+// at MAX_SIMTIME_T
+static inline SimTime_t
+lastTime(SimTime_t start, SimTime_t length)
+{
+    if ( length - 1 > MAX_SIMTIME_T - start ) return MAX_SIMTIME_T;
+    return start + (length - 1);
+}
+
+template <bool TS>
+TimeVortexLadderQueueBase<TS>::TimeVortexLadderQueueBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    top_covered(0),
+    top_min(0),
+    top_max(0),
+    rungs(max_rungs),
+    num_rungs(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+}
+
+template <bool TS>
+TimeVortexLadderQueueBase<TS>::~TimeVortexLadderQueueBase()
+{
+    // Activities in TimeVortexLadderQueue all need to be deleted
+    for ( auto x : top ) {
+        delete x;
+    }
+    for ( auto& rung : rungs ) {
+        for ( auto& bucket : rung.buckets ) {
+            for ( auto x : bucket ) {
+                delete x;
+            }
+        }
+    }
+    for ( auto x : bottom ) {
+        delete x;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderQueueBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexLadderQueueBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    SimTime_t time = activity->getDeliveryTime();
+
+    if ( time > top_covered ) {
+        if ( top.empty() ) {
+            top_min = time;
+            top_max = time;
+        }
+        else {
+            top_min = std::min(top_min, time);
+            top_max = std::max(top_max, time);
+        }
+        top.push_back(activity);
+    }
+    else {
+        // Find the coarsest rung whose remaining buckets hold this time,
+        // otherwise it is earlier than every remaining bucket
+        size_t i = 0;
+        for ( ; i < num_rungs; i++ ) {
+            Rung& rung = rungs[i];
+            if ( time >= rung.start_time && (time - rung.start_time) / rung.bucket_width >= rung.cur_bucket ) {
+                rung.buckets[(time - rung.start_time) / rung.bucket_width].push_back(activity);
+                break;
+            }
+        }
+        if ( i == num_rungs ) {
+            bottom.push_back(activity);
+            std::push_heap(bottom.begin(), bottom.end(), heap_order);
+        }
+    }
+
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderQueueBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    fillBottom();
+    if ( bottom.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    std::pop_heap(bottom.begin(), bottom.end(), heap_order);
+    Activity* ret_val = bottom.back();
+    bottom.pop_back();
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderQueueBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    fillBottom();
+    Activity* ret = bottom.empty() ? nullptr : bottom.front();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+SimTime_t
+TimeVortexLadderQueueBase<TS>::spawnRung(ActivityList& list, SimTime_t first_time, SimTime_t last_time)
+{
+    Rung&     rung = rungs[num_rungs++];
+    SimTime_t span = last_time - first_time;
+    size_t    n    = std::min(list.size(), max_buckets);
+
+    rung.start_time   = first_time;
+    rung.bucket_width = span / n + 1;
+    rung.num_buckets  = span / rung.bucket_width + 1;
+    rung.cur_bucket   = 0;
+    if ( rung.buckets.size() < rung.num_buckets ) rung.buckets.resize(rung.num_buckets);
+
+    for ( auto x : list ) {
+        rung.buckets[(x->getDeliveryTime() - first_time) / rung.bucket_width].push_back(x);
+    }
+    list.clear();
+
+    // Last time held by the last bucket
+    return lastTime(first_time + (rung.num_buckets - 1) * rung.bucket_width, rung.bucket_width);
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::moveToBottom(ActivityList& list)
+{
+    bottom.insert(bottom.end(), list.begin(), list.end());
+    list.clear();
+    std::make_heap(bottom.begin(), bottom.end(), heap_order);
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::fillBottom()
+{
+    while ( bottom.empty() ) {
+        if ( num_rungs == 0 ) {
+            if ( top.empty() ) return;
+            if ( top.size() <= threshold ) {
+                top_covered = top_max;
+                moveToBottom(top);
+            }
+            else {
+                top_covered = spawnRung(top, top_min, top_max);
+            }
+            continue;
+        }
+
+        // Move down the next bucket of the finest rung
+        Rung& rung = rungs[num_rungs - 1];
+        while ( rung.cur_bucket < rung.num_buckets && rung.buckets[rung.cur_bucket].empty() ) {
+            rung.cur_bucket++;
+        }
+        if ( rung.cur_bucket == rung.num_buckets ) {
+            num_rungs--;
+            continue;
+        }
+
+        ActivityList& bucket     = rung.buckets[rung.cur_bucket];
+        SimTime_t     first_time = rung.start_time + rung.cur_bucket * rung.bucket_width;
+        rung.cur_bucket++;
+        if ( bucket.size() > threshold && rung.bucket_width > 1 && num_rungs < max_rungs ) {
+            spawnRung(bucket, first_time, lastTime(first_time, rung.bucket_width));
+        }
+        else {
+            moveToBottom(bucket);
+        }
+    }
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  top: %zu activities after %" PRIu64 "\n", top.size(), top_covered);
+    for ( size_t i = 0; i < num_rungs; i++ ) {
+        const Rung& rung = rungs[i];
+        out.output(
+            "  rung %zu: %zu buckets of width %" PRIu64 " from %" PRIu64 ", next bucket %zu\n", i, rung.num_buckets,
+            rung.bucket_width, rung.start_time, rung.cur_bucket);
+    }
+    out.output("  bottom: %zu activities\n", bottom.size());
+}
+
+class TimeVortexLadderQueue : public TimeVortexLadderQueueBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadderQueue,
+        "sst",
+        "timevortex.ladder_queue",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on a ladder queue with amortized constant time insert and pop.")
+
+
+    TimeVortexLadderQueue(Params& params) : TimeVortexLadderQueueBase<false>(params) {}
+    ~TimeVortexLadderQueue() {}
+    SST_ELI_EXPORT(TimeVortexLadderQueue)
+};
+
+class TimeVortexLadderQueue_ts : public TimeVortexLadderQueueBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadderQueue_ts,
+        "sst",
+        "timevortex.ladder_queue.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex based on a ladder queue.  Do not reference this element directly, just specify sst.timevortex.ladder_queue and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexLadderQueue_ts(Params& params) : TimeVortexLadderQueueBase<true>(params) {}
+    ~TimeVortexLadderQueue_ts() {}
+    SST_ELI_EXPORT(TimeVortexLadderQueue_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
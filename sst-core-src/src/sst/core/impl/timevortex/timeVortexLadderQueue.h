@@ -0,0 +1,107 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a ladder queue.
+ *
+ * Activities far in the future are appended unsorted to the top.
+ * When the earlier activities run out, the top is spread into a rung
+ * of time buckets, and crowded buckets are spread into finer rungs.
+ * Only the earliest bucket is kept in a heap at the bottom, so insert
+ * and pop are amortized O(1) when most activities are posted a short
+ * time ahead.  The bucket storage is kept between rungs so its
+ * capacity is reused.
+ */
+template <bool TS>
+class TimeVortexLadderQueueBase : public TimeVortex
+{
+
+public:
+    TimeVortexLadderQueueBase(Params& params);
+    ~TimeVortexLadderQueueBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::vector<Activity*> ActivityList;
+
+    // Buckets of width bucket_width, the first one starting at
+    // start_time.  Buckets before cur_bucket have been moved down.
+    struct Rung
+    {
+        SimTime_t                 start_time;
+        SimTime_t                 bucket_width;
+        size_t                    num_buckets;
+        size_t                    cur_bucket;
+        std::vector<ActivityList> buckets;
+    };
+
+    // A bucket with more activities than this is spread into a new
+    // rung instead of moved to the bottom
+    static constexpr size_t threshold   = 50;
+    static constexpr size_t max_rungs   = 8;
+    static constexpr size_t max_buckets = 1 << 16;
+
+    SimTime_t spawnRung(ActivityList& list, SimTime_t first_time, SimTime_t last_time);
+    void      moveToBottom(ActivityList& list);
+    void      fillBottom();
+
+    // Unsorted activities delivered after top_covered
+    ActivityList top;
+    SimTime_t    top_covered;
+    SimTime_t    top_min;
+    SimTime_t    top_max;
+
+    // Rungs in use are rungs[0, num_rungs), later rungs are finer.
+    // The vector is never resized, so references to rungs stay valid.
+    std::vector<Rung> rungs;
+    size_t            num_rungs;
+
+    // Heap of the earliest activities
+    ActivityList bottom;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
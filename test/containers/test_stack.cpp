@@ -77,3 +77,32 @@ TEST(Stack, Grow) {
   EXPECT_EQ(s.size(), 0);
   EXPECT_EQ(s.pop(check), pando::Status::OutOfBounds);
 }
+
+TEST(Stack, Arena) {
+  uint64_t check;
+  galois::Arena arena;
+  EXPECT_EQ(arena.initialize(4096), pando::Status::Success);
+  const std::uint64_t mark = arena.mark();
+  {
+    galois::ScopedRegion region(arena);
+    galois::Stack<uint64_t, galois::Arena> s;
+    EXPECT_EQ(s.initialize(0, arena), pando::Status::Success);
+    EXPECT_EQ(s.capacity(), 1);
+
+    for (uint64_t i = 0; i < 101; i++) {
+      EXPECT_EQ(s.emplace(canary + i), pando::Status::Success);
+    }
+    EXPECT_EQ(s.size(), 101);
+    EXPECT_GT(arena.mark(), mark);
+    for (uint64_t i = 101; i > 0; i--) {
+      EXPECT_EQ(s.pop(check), pando::Status::Success);
+      EXPECT_EQ(check, canary + i - 1);
+    }
+    s.deinitialize();
+  }
+  EXPECT_EQ(arena.mark(), mark);
+
+  galois::Stack<uint64_t, galois::Arena> s;
+  EXPECT_EQ(s.initialize(4096, arena), pando::Status::BadAlloc);
+  arena.deinitialize();
+}
@@ -187,6 +187,47 @@ TEST(ThreadLocalVector, DoAll) {
   perThreadVec.deinitialize();
 }
 
+TEST(ThreadLocalVector, Appender) {
+  galois::ThreadLocalVector<uint64_t> perThreadVec;
+  EXPECT_EQ(perThreadVec.initialize(), pando::Status::Success);
+
+  static const uint64_t workItems = 100;
+  static const uint64_t appendsPerItem = 10;
+  galois::DistArray<uint64_t> work;
+  EXPECT_EQ(work.initialize(workItems), pando::Status::Success);
+  for (uint64_t i = 0; i < workItems; i++) {
+    work[i] = i;
+  }
+
+  galois::doAll(
+      perThreadVec, work, +[](galois::ThreadLocalVector<uint64_t>& perThreadVec, uint64_t x) {
+        pando::Vector<uint64_t> staleVec = perThreadVec.getLocalRef();
+        {
+          auto appender = perThreadVec.getAppender();
+          for (uint64_t i = 0; i < appendsPerItem; i++) {
+            EXPECT_EQ(appender.pushBack(x), pando::Status::Success);
+          }
+          EXPECT_EQ(appender.size(), staleVec.size() + appendsPerItem);
+        }
+        pando::Vector<uint64_t> localVec = perThreadVec.getLocalRef();
+        EXPECT_EQ(pando::localityOf(localVec.data()).node.id, pando::getCurrentPlace().node.id);
+        EXPECT_EQ(localVec.size(), staleVec.size() + appendsPerItem);
+      });
+  EXPECT_EQ(perThreadVec.sizeAll(), workItems * appendsPerItem);
+
+  galois::HostCachedArray<uint64_t> hca = PANDO_EXPECT_CHECK(perThreadVec.hostCachedFlatten());
+  EXPECT_EQ(hca.size(), workItems * appendsPerItem);
+  uint64_t sum = 0;
+  for (uint64_t elt : hca) {
+    sum += elt;
+  }
+  EXPECT_EQ(sum, ((workItems - 1) + 0) * (workItems / 2) * appendsPerItem);
+
+  hca.deinitialize();
+  work.deinitialize();
+  perThreadVec.deinitialize();
+}
+
 TEST(ThreadLocalVector, HostLocalStorageVector) {
   constexpr std::uint64_t size = 32;
   pando::Status err;
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "pando-rt/export.h"
+#include <pando-lib-galois/graphs/compact_local_csr.hpp>
+#include <pando-lib-galois/graphs/graph_traits.hpp>
+#include <pando-rt/containers/vector.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+namespace {
+
+pando::Vector<pando::Vector<std::uint64_t>> generateEdgeLists(
+    std::vector<std::vector<std::uint64_t>> edgeLists) {
+  pando::Vector<pando::Vector<std::uint64_t>> vec;
+  EXPECT_EQ(vec.initialize(edgeLists.size()), pando::Status::Success);
+  for (std::uint64_t i = 0; i < edgeLists.size(); i++) {
+    pando::Vector<std::uint64_t> inner;
+    EXPECT_EQ(inner.initialize(0), pando::Status::Success);
+    for (std::uint64_t dst : edgeLists[i]) {
+      EXPECT_EQ(inner.pushBack(dst), pando::Status::Success);
+    }
+    vec[i] = inner;
+  }
+  return vec;
+}
+
+void deleteEdgeLists(pando::Vector<pando::Vector<std::uint64_t>> vec) {
+  for (pando::Vector<std::uint64_t> inner : vec) {
+    inner.deinitialize();
+  }
+  vec.deinitialize();
+}
+
+const std::vector<std::vector<std::uint64_t>> edgeLists = {
+    {1, 2, 3},
+    {},
+    {0, 2},
+    {3, 1, 0, 2},
+};
+
+} // namespace
+
+using Graph = galois::CompactLCSR<std::uint64_t, std::uint64_t>;
+
+TEST(CompactLCSR, Topology) {
+  auto vec = generateEdgeLists(edgeLists);
+  Graph graph;
+  EXPECT_EQ(graph.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+  EXPECT_EQ(graph.size(), edgeLists.size());
+  EXPECT_EQ(graph.sizeEdges(), 9);
+
+  std::uint64_t i = 0;
+  for (typename galois::graph_traits<Graph>::VertexTopologyID vert : graph.vertices()) {
+    EXPECT_EQ(graph.getVertexIndex(vert), i);
+    EXPECT_EQ(graph.getTopologyIDFromIndex(i), vert);
+    EXPECT_TRUE(graph.isLocal(vert));
+    EXPECT_EQ(graph.getNumEdges(vert), edgeLists[i].size());
+    EXPECT_EQ(graph.edges(vert).size(), edgeLists[i].size());
+    std::uint64_t j = 0;
+    for (typename galois::graph_traits<Graph>::EdgeHandle eh : graph.edges(vert)) {
+      EXPECT_EQ(graph.getVertexIndex(graph.getEdgeDst(eh)), edgeLists[i][j]);
+      EXPECT_EQ(graph.getEdgeDst(vert, j), graph.getEdgeDst(eh));
+      j++;
+    }
+    i++;
+  }
+  graph.deinitialize();
+}
+
+TEST(CompactLCSR, Data) {
+  auto vec = generateEdgeLists(edgeLists);
+  Graph graph;
+  EXPECT_EQ(graph.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+
+  std::uint64_t i = 0;
+  for (typename galois::graph_traits<Graph>::VertexTopologyID vert : graph.vertices()) {
+    graph.setData(vert, i);
+    std::uint64_t j = 0;
+    for (typename galois::graph_traits<Graph>::EdgeHandle eh : graph.edges(vert)) {
+      graph.setEdgeData(eh, i * 10 + j);
+      j++;
+    }
+    i++;
+  }
+
+  i = 0;
+  for (pando::GlobalRef<std::uint64_t> vdata : graph.vertexDataRange()) {
+    EXPECT_EQ(vdata, i);
+    i++;
+  }
+  EXPECT_EQ(i, edgeLists.size());
+
+  i = 0;
+  for (typename galois::graph_traits<Graph>::VertexTopologyID vert : graph.vertices()) {
+    std::uint64_t j = 0;
+    for (std::uint64_t edata : graph.edgeDataRange(vert)) {
+      EXPECT_EQ(edata, i * 10 + j);
+      EXPECT_EQ(graph.getEdgeData(vert, j), i * 10 + j);
+      j++;
+    }
+    EXPECT_EQ(j, edgeLists[i].size());
+    i++;
+  }
+  graph.deinitialize();
+}
+
+TEST(CompactLCSR, EdgeWindow) {
+  auto vec = generateEdgeLists(edgeLists);
+  Graph graph;
+  EXPECT_EQ(graph.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+
+  auto vert = graph.getTopologyIDFromIndex(3);
+  auto window = graph.edges(vert, 1, 2);
+  EXPECT_EQ(window.size(), 2);
+  EXPECT_EQ(graph.getVertexIndex(graph.getEdgeDst(*window.begin())), 1);
+  EXPECT_EQ(graph.edges(vert, 3, 10).size(), 1);
+  EXPECT_EQ(graph.edges(vert, 5, 10).size(), 0);
+  graph.deinitialize();
+}
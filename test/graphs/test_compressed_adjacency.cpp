@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "pando-rt/export.h"
+#include <pando-lib-galois/graphs/compact_local_csr.hpp>
+#include <pando-lib-galois/graphs/compressed_adjacency.hpp>
+#include <pando-lib-galois/graphs/local_csr.hpp>
+#include <pando-rt/containers/vector.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+namespace {
+
+pando::Vector<pando::Vector<std::uint64_t>> generateEdgeLists(
+    std::vector<std::vector<std::uint64_t>> edgeLists) {
+  pando::Vector<pando::Vector<std::uint64_t>> vec;
+  EXPECT_EQ(vec.initialize(edgeLists.size()), pando::Status::Success);
+  for (std::uint64_t i = 0; i < edgeLists.size(); i++) {
+    pando::Vector<std::uint64_t> inner;
+    EXPECT_EQ(inner.initialize(0), pando::Status::Success);
+    for (std::uint64_t dst : edgeLists[i]) {
+      EXPECT_EQ(inner.pushBack(dst), pando::Status::Success);
+    }
+    vec[i] = inner;
+  }
+  return vec;
+}
+
+void deleteEdgeLists(pando::Vector<pando::Vector<std::uint64_t>> vec) {
+  for (pando::Vector<std::uint64_t> inner : vec) {
+    inner.deinitialize();
+  }
+  vec.deinitialize();
+}
+
+template <typename Graph>
+void checkFromGraph() {
+  std::vector<std::vector<std::uint64_t>> edgeLists = {
+      {3, 1, 2}, {}, {0, 4, 1}, {3, 3}, {0, 1, 2, 3, 4},
+  };
+  auto vec = generateEdgeLists(edgeLists);
+  Graph graph;
+  EXPECT_EQ(graph.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+  galois::CompressedAdjacency adj;
+  EXPECT_EQ(adj.initialize(graph), pando::Status::Success);
+  EXPECT_EQ(adj.size(), graph.size());
+  EXPECT_EQ(adj.sizeEdges(), graph.sizeEdges());
+
+  for (std::uint64_t vertex = 0; vertex < edgeLists.size(); vertex++) {
+    std::vector<std::uint64_t> expected = edgeLists[vertex];
+    std::sort(expected.begin(), expected.end());
+    std::vector<std::uint64_t> actual;
+    for (std::uint64_t neighbor : adj.edges(vertex)) {
+      actual.push_back(neighbor);
+    }
+    EXPECT_EQ(actual, expected);
+  }
+  adj.deinitialize();
+  graph.deinitialize();
+}
+
+} // namespace
+
+TEST(CompressedAdjacency, DefaultConstructed) {
+  galois::CompressedAdjacency adj;
+  EXPECT_EQ(adj.size(), 0);
+  EXPECT_EQ(adj.sizeEdges(), 0);
+  EXPECT_EQ(adj.sizeBytes(), 0);
+}
+
+TEST(CompressedAdjacency, Empty) {
+  auto vec = generateEdgeLists({{}, {}});
+  galois::CompressedAdjacency adj;
+  EXPECT_EQ(adj.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+  EXPECT_EQ(adj.size(), 2);
+  EXPECT_EQ(adj.sizeEdges(), 0);
+  EXPECT_EQ(adj.sizeBytes(), 0);
+  for (std::uint64_t vertex = 0; vertex < adj.size(); vertex++) {
+    EXPECT_EQ(adj.getNumEdges(vertex), 0);
+    EXPECT_TRUE(adj.edges(vertex).begin() == adj.edges(vertex).end());
+  }
+  adj.deinitialize();
+}
+
+TEST(CompressedAdjacency, SortedNeighbors) {
+  std::vector<std::vector<std::uint64_t>> edgeLists = {
+      {3, 1, 2},
+      {},
+      {0, 1ull << 40, 200, 201, 70000},
+      {3, 3},
+  };
+  auto vec = generateEdgeLists(edgeLists);
+  galois::CompressedAdjacency adj;
+  EXPECT_EQ(adj.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+  EXPECT_EQ(adj.size(), edgeLists.size());
+  EXPECT_EQ(adj.sizeEdges(), 10);
+  // gaps below 128 take one byte, 200 takes two, 70000 - 201 takes three and 2^40 - 70000 takes six
+  EXPECT_EQ(adj.sizeBytes(), 3 + 1 + 2 + 1 + 3 + 6 + 2);
+
+  for (std::uint64_t vertex = 0; vertex < edgeLists.size(); vertex++) {
+    std::vector<std::uint64_t> expected = edgeLists[vertex];
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(adj.getNumEdges(vertex), expected.size());
+    EXPECT_EQ(adj.edges(vertex).size(), expected.size());
+    std::vector<std::uint64_t> actual;
+    for (std::uint64_t neighbor : adj.edges(vertex)) {
+      actual.push_back(neighbor);
+    }
+    EXPECT_EQ(actual, expected);
+  }
+  adj.deinitialize();
+}
+
+TEST(CompressedAdjacency, CodesAcrossBlocks) {
+  // two byte codes that straddle the boundaries of the blocks read by the iterators
+  std::vector<std::vector<std::uint64_t>> edgeLists(2);
+  for (std::uint64_t i = 0; i < 3 * galois::CompressedAdjacency::NeighborIterator::BLOCK_SIZE;
+       i++) {
+    edgeLists[0].push_back(i * 200 + 200);
+    edgeLists[1].push_back(i);
+  }
+  auto vec = generateEdgeLists(edgeLists);
+  galois::CompressedAdjacency adj;
+  EXPECT_EQ(adj.initialize(vec), pando::Status::Success);
+  deleteEdgeLists(vec);
+
+  for (std::uint64_t vertex = 0; vertex < edgeLists.size(); vertex++) {
+    std::vector<std::uint64_t> actual;
+    for (std::uint64_t neighbor : adj.edges(vertex)) {
+      actual.push_back(neighbor);
+    }
+    EXPECT_EQ(actual, edgeLists[vertex]);
+  }
+  adj.deinitialize();
+}
+
+TEST(CompressedAdjacency, FromLCSR) {
+  checkFromGraph<galois::LCSR<std::uint64_t, std::uint64_t>>();
+}
+
+TEST(CompressedAdjacency, FromCompactLCSR) {
+  checkFromGraph<galois::CompactLCSR<std::uint64_t, std::uint64_t>>();
+}
@@ -94,6 +94,36 @@ TEST(LCSR, VertexData) {
     EXPECT_EQ(vdata, i);
     i++;
   }
+  EXPECT_EQ(i, SIZE);
+  graph.deinitialize();
+}
+
+TEST(LCSR, VertexField) {
+  struct VertexData {
+    std::uint64_t id;
+    std::uint64_t dist;
+  };
+  constexpr std::uint64_t SIZE = 10;
+  galois::LCSR<VertexData, std::uint64_t> graph;
+  auto vec = generateFullyConnectedGraph(SIZE);
+  EXPECT_EQ(graph.initialize(vec), pando::Status::Success);
+  EXPECT_EQ(deleteVectorVector<std::uint64_t>(vec), pando::Status::Success);
+  std::uint64_t i = 0;
+  for (pando::GlobalPtr<galois::Vertex> vert : graph.vertices()) {
+    graph.setData(vert, VertexData{i, SIZE + i});
+    i++;
+  }
+
+  i = 0;
+  for (pando::GlobalPtr<galois::Vertex> vert : graph.vertices()) {
+    EXPECT_EQ(graph.getField<&VertexData::id>(vert), i);
+    EXPECT_EQ(graph.getField<&VertexData::dist>(vert), SIZE + i);
+    graph.getField<&VertexData::dist>(vert) = i;
+    VertexData data = graph.getData(vert);
+    EXPECT_EQ(data.id, i);
+    EXPECT_EQ(data.dist, i);
+    i++;
+  }
   graph.deinitialize();
 }
 
@@ -139,6 +169,7 @@ TEST(LCSR, DataRange) {
     vert = i;
     i++;
   }
+  EXPECT_EQ(i, SIZE);
 
   for (typename galois::graph_traits<Graph>::VertexTopologyID vert : graph.vertices()) {
     std::uint64_t j = 0;
@@ -155,6 +186,7 @@ TEST(LCSR, DataRange) {
     EXPECT_EQ(vert, i);
     i++;
   }
+  EXPECT_EQ(i, SIZE);
 
   for (typename galois::graph_traits<Graph>::VertexTopologyID vert : graph.vertices()) {
     std::uint64_t j = 0;
@@ -533,6 +533,115 @@ TEST(PartitionEdgesSerially, Serially) {
   localEdges.deinitialize();
 }
 
+TEST(PartitionEdgesParallel, Parallel) {
+  constexpr std::uint64_t SIZE = 32;
+  pando::Status err;
+
+  std::uint64_t numVirtualHosts = 16;
+  std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
+
+  galois::DistArray<galois::WMDEdge> edges;
+  err = edges.initialize(SIZE * SIZE);
+  PANDO_CHECK(err);
+
+  for (std::uint64_t i = 0; i < SIZE; i++) {
+    for (std::uint64_t j = 0; j < SIZE; j++) {
+      edges[i * SIZE + j] = genEdge(i, j, SIZE);
+    }
+  }
+
+  galois::PerThreadVector<pando::Vector<galois::WMDEdge>> localEdges;
+  err = localEdges.initialize();
+  EXPECT_EQ(err, pando::Status::Success);
+
+  pando::GlobalPtr<galois::HashTable<std::uint64_t, std::uint64_t>> hashPtr;
+  pando::LocalStorageGuard hashGuard(hashPtr, localEdges.size());
+  for (std::uint64_t i = 0; i < localEdges.size(); i++) {
+    hashPtr[i] = galois::HashTable<std::uint64_t, std::uint64_t>();
+    err = fmap(hashPtr[i], initialize, 0);
+    EXPECT_EQ(err, pando::Status::Success);
+  }
+
+  struct State {
+    pando::GlobalPtr<galois::HashTable<std::uint64_t, std::uint64_t>> hashPtr;
+    galois::PerThreadVector<pando::Vector<galois::WMDEdge>> localEdges;
+  };
+
+  auto f = +[](State s, galois::WMDEdge edge) {
+    pando::Status err;
+    err = galois::internal::insertLocalEdgesPerThread(s.hashPtr[s.localEdges.getLocalVectorID()],
+                                                      s.localEdges.getThreadVector(), edge);
+    EXPECT_EQ(err, pando::Status::Success);
+  };
+
+  err = galois::doAll(State{hashPtr, localEdges}, edges, f);
+  EXPECT_EQ(err, pando::Status::Success);
+
+  pando::Array<std::uint64_t> v2PM;
+  err = v2PM.initialize(numVirtualHosts);
+  EXPECT_EQ(err, pando::Status::Success);
+  for (std::uint64_t i = 0; i < numVirtualHosts; i++) {
+    v2PM[i] = i % numHosts;
+  }
+
+  galois::HostLocalStorage<pando::Vector<pando::Vector<galois::WMDEdge>>> partitionedEdges{};
+  err = partitionedEdges.initialize();
+  EXPECT_EQ(err, pando::Status::Success);
+
+  galois::HostLocalStorage<galois::HashTable<std::uint64_t, std::uint64_t>> perHostRename{};
+  err = perHostRename.initialize();
+  EXPECT_EQ(err, pando::Status::Success);
+
+  auto g = +[](pando::NotificationHandle done, decltype(localEdges) le,
+               decltype(v2PM) virtual2Physical, decltype(partitionedEdges) pe,
+               decltype(perHostRename) phr) {
+    auto err =
+        galois::internal::partitionEdgesParallel<galois::WMDEdge>(le, virtual2Physical, pe, phr);
+    PANDO_CHECK(err);
+    done.notify();
+  };
+  pando::Notification notify;
+  err = notify.init();
+  EXPECT_EQ(err, pando::Status::Success);
+
+  auto place = pando::Place{pando::NodeIndex{0}, pando::anyPod, pando::anyCore};
+  err = pando::executeOn(place, g, notify.getHandle(), localEdges, v2PM, partitionedEdges,
+                         perHostRename);
+  EXPECT_EQ(err, pando::Status::Success);
+  notify.wait();
+
+  for (std::uint64_t host = 0; host < numHosts; host++) {
+    pando::Vector<pando::Vector<galois::WMDEdge>> vVec = partitionedEdges[host];
+    galois::HashTable<std::uint64_t, std::uint64_t> rename = perHostRename[host];
+    EXPECT_EQ(pando::localityOf(vVec.data()).node.id, static_cast<std::int64_t>(host));
+    EXPECT_EQ(vVec.size(), SIZE / numHosts);
+    EXPECT_EQ(rename.size(), SIZE / numHosts);
+    for (std::uint64_t i = 0; i < vVec.size(); i++) {
+      pando::Vector<galois::WMDEdge> vec = vVec[i];
+      EXPECT_EQ(vec.size(), SIZE);
+      galois::WMDEdge edge = vec[0];
+      std::uint64_t edgeSrc = edge.src;
+      EXPECT_EQ(galois::internal::getPhysical(edgeSrc, v2PM), host);
+      std::uint64_t index = 0;
+      EXPECT_TRUE(rename.get(edgeSrc, index));
+      EXPECT_EQ(index, i);
+      for (galois::WMDEdge val : vec) {
+        EXPECT_EQ(val.src, edgeSrc);
+      }
+      vec.deinitialize();
+    }
+    vVec.deinitialize();
+    rename.deinitialize();
+  }
+  partitionedEdges.deinitialize();
+  perHostRename.deinitialize();
+  for (std::uint64_t i = 0; i < localEdges.size(); i++) {
+    liftVoid(hashPtr[i], deinitialize);
+  }
+  v2PM.deinitialize();
+  localEdges.deinitialize();
+}
+
 TEST(Integration, InsertEdgeCountVirtual2Physical) {
   constexpr std::uint64_t SIZE = 32;
   pando::Status err;
@@ -631,6 +740,64 @@ TEST(Integration, InsertEdgeCountVirtual2Physical) {
   edges.deinitialize();
 }
 
+void checkEdgeBalancedRanges(std::uint64_t numHosts, std::vector<std::uint64_t> counts) {
+  const std::uint64_t numVirtualHosts = counts.size();
+  pando::Array<galois::Pair<std::uint64_t, std::uint64_t>> edgeCounts;
+  EXPECT_EQ(edgeCounts.initialize(numVirtualHosts), pando::Status::Success);
+  std::uint64_t totalEdges = 0;
+  std::uint64_t maxCount = 0;
+  for (std::uint64_t i = 0; i < numVirtualHosts; i++) {
+    edgeCounts[i] = galois::Pair<std::uint64_t, std::uint64_t>{counts[i], i};
+    totalEdges += counts[i];
+    maxCount = std::max(maxCount, counts[i]);
+  }
+
+  auto [virtualToPhysicalMapping, numEdges] =
+      PANDO_EXPECT_CHECK(galois::internal::buildVirtualToPhysicalMapping(
+          numHosts, edgeCounts, galois::VirtualHostPolicy::EdgeBalancedRanges));
+  EXPECT_EQ(virtualToPhysicalMapping.size(), numVirtualHosts);
+
+  // every physical host owns a non-empty contiguous range of ids
+  EXPECT_EQ(virtualToPhysicalMapping[0], 0u);
+  for (std::uint64_t i = 1; i < numVirtualHosts; i++) {
+    const std::uint64_t prev = virtualToPhysicalMapping[i - 1];
+    const std::uint64_t curr = virtualToPhysicalMapping[i];
+    EXPECT_TRUE(curr == prev || curr == prev + 1);
+  }
+  EXPECT_EQ(virtualToPhysicalMapping[numVirtualHosts - 1], numHosts - 1);
+
+  std::vector<std::uint64_t> hostEdges(numHosts, 0);
+  for (std::uint64_t i = 0; i < numVirtualHosts; i++) {
+    EXPECT_EQ(galois::internal::getPhysical(i, virtualToPhysicalMapping),
+              virtualToPhysicalMapping[i]);
+    hostEdges[virtualToPhysicalMapping[i]] += counts[i];
+  }
+  for (std::uint64_t host = 0; host < numHosts; host++) {
+    EXPECT_EQ(static_cast<std::uint64_t>(numEdges[host]), hostEdges[host]);
+    EXPECT_LE(hostEdges[host], totalEdges / numHosts + maxCount);
+  }
+
+  virtualToPhysicalMapping.deinitialize();
+  numEdges.deinitialize();
+  edgeCounts.deinitialize();
+}
+
+TEST(BuildVirtualToPhysicalMapping, EdgeBalancedRanges) {
+  // power-law like degrees, with the hubs at the front
+  std::vector<std::uint64_t> counts;
+  for (std::uint64_t i = 0; i < 64; i++) {
+    counts.push_back(1024 / (i + 1));
+  }
+  checkEdgeBalancedRanges(4, counts);
+}
+
+TEST(BuildVirtualToPhysicalMapping, EdgeBalancedRangesSkewed) {
+  // one hub holds most edges, yet every host gets a range
+  checkEdgeBalancedRanges(4, {1, 1000, 1, 1, 1, 1});
+  checkEdgeBalancedRanges(4, {0, 0, 0, 0, 0, 0, 0, 0, 0});
+  checkEdgeBalancedRanges(3, {5, 5, 5});
+}
+
 void getNumVerticesAndEdges(std::string& filename, uint64_t& numVertices, uint64_t& numEdges) {
   std::cout << "filename: " << filename << "\n";
   std::ifstream file(filename);
@@ -441,6 +441,188 @@ void run_test_launch_edge_exchange(pando::Notification::HandleType hb_done) {
   hb_done.notify();
 }
 
+void run_test_launch_stream_edge_exchange(pando::Notification::HandleType hb_done) {
+  std::vector<EdgeVectorSTL> expected_final_EL = {
+      {Edge{8, 9}, Edge{6, 7}, Edge{4, 5}, Edge{4, 6}},
+      {Edge{3, 4}, Edge{1, 2}, Edge{1, 3}, Edge{7, 8}, Edge{1, 7}},
+      {Edge{5, 6}, Edge{2, 3}, Edge{2, 7}}};
+  auto num_hosts = pando::getPlaceDims().node.id;
+  auto size = num_hosts * NUM_VHOSTS_PER_HOST;
+
+  pando::GlobalPtr<bool> dones = static_cast<pando::GlobalPtr<bool>>(
+      pando::getDefaultMainMemoryResource()->allocate(sizeof(bool) * num_hosts));
+  for (auto i = 0; i < num_hosts; i++)
+    dones[i] = false;
+  pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host =
+      static_cast<pando::GlobalPtr<pando::Vector<int64_t>>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(pando::Vector<int64_t>) *
+                                                          num_hosts));
+  pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost =
+      static_cast<pando::GlobalPtr<EdgeVectorPando>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(EdgeVectorPando) * size));
+  pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host =
+      static_cast<pando::GlobalPtr<EdgeVectorPando>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(EdgeVectorPando) * num_hosts));
+
+  std::vector<EdgeVectorSTL> given_vhostEdgesPerHost = {
+      {Edge{8, 9}},             // 0
+      {Edge{1, 2}, Edge{1, 3}}, // 1
+      {},                       // 2
+      {Edge{3, 4}},             // 3
+      {},                       // 4
+      {},                       // 5
+      {},                       // 6
+      {},                       // 7
+      {},                       // 8
+      {},                       // 9
+      {},                       // 10
+      {},                       // 11
+      {Edge{4, 5}, Edge{4, 6}}, // 12
+      {Edge{5, 6}},             // 13
+      {Edge{6, 7}},             // 14
+      {},                       // 15
+      {},                       // 16
+      {Edge{1, 7}},             // 17
+      {Edge{2, 3}, Edge{2, 7}}, // 18
+      {},                       // 19
+      {},                       // 20
+      {},                       // 21
+      {},                       // 22
+      {Edge{7, 8}},             // 23
+  };
+  for (auto i = 0; i < size; i++) {
+    EdgeVectorPando ev = global_vhostEdgesPerHost[i];
+    PANDO_CHECK(ev.initialize(0));
+    for (size_t j = 0; j < given_vhostEdgesPerHost[i].size(); j++) {
+      PANDO_CHECK(ev.pushBack(given_vhostEdgesPerHost[i][j]));
+    }
+    global_vhostEdgesPerHost[i] = std::move(ev);
+  }
+  std::vector<std::vector<int64_t>> given_vhosts_per_host = {{0, 6, 4}, {3, 7, 1}, {5, 2}};
+  for (auto i = 0; i < num_hosts; i++) {
+    pando::Vector<int64_t> vhosts_host_i = vhosts_per_host[i];
+    PANDO_CHECK(vhosts_host_i.initialize(0));
+    for (size_t j = 0; j < given_vhosts_per_host[i].size(); j++) {
+      PANDO_CHECK(vhosts_host_i.pushBack(given_vhosts_per_host[i][j]));
+    }
+    vhosts_per_host[i] = std::move(vhosts_host_i);
+  }
+
+  launch_stream_edge_exchange(dones, final_edgelist_per_host, vhosts_per_host,
+                              global_vhostEdgesPerHost, NUM_VHOSTS_PER_HOST);
+
+  // Edges arrive in the same order as with launch_edge_exchange
+  for (auto i = 0; i < num_hosts; i++) {
+    EdgeVectorPando el_hostI = final_edgelist_per_host[i];
+    EXPECT_EQ(el_hostI.size(), expected_final_EL[i].size());
+    for (size_t j = 0; j < el_hostI.size(); j++) {
+      Edge actual_e = el_hostI[j];
+      EXPECT_EQ(actual_e.src, expected_final_EL[i][j].src);
+      EXPECT_EQ(actual_e.dest, expected_final_EL[i][j].dest);
+    }
+    el_hostI.deinitialize();
+  }
+  check_dones_reset(dones);
+
+  for (auto i = 0; i < size; i++) {
+    EdgeVectorPando ev = global_vhostEdgesPerHost[i];
+    ev.deinitialize();
+  }
+  for (auto i = 0; i < num_hosts; i++) {
+    pando::Vector<int64_t> vhosts_host_i = vhosts_per_host[i];
+    vhosts_host_i.deinitialize();
+  }
+  pando::deallocateMemory(dones, num_hosts);
+  pando::deallocateMemory(vhosts_per_host, num_hosts);
+  pando::deallocateMemory(global_vhostEdgesPerHost, size);
+  pando::deallocateMemory(final_edgelist_per_host, num_hosts);
+  hb_done.notify();
+}
+
+// Every vhost holds more than EDGE_EXCHANGE_BATCH_SIZE edges, so each one is copied in several
+// transfers
+void run_test_launch_stream_edge_exchange_large(pando::Notification::HandleType hb_done) {
+  int64_t num_hosts = pando::getPlaceDims().node.id;
+  int64_t size = num_hosts * NUM_VHOSTS_PER_HOST;
+  auto vhost_num_edges = [](int64_t h, int64_t v) -> size_t {
+    return (1 + (h + v) % 3) * EDGE_EXCHANGE_BATCH_SIZE + h + v + 1;
+  };
+
+  pando::GlobalPtr<bool> dones = static_cast<pando::GlobalPtr<bool>>(
+      pando::getDefaultMainMemoryResource()->allocate(sizeof(bool) * num_hosts));
+  for (int64_t i = 0; i < num_hosts; i++)
+    dones[i] = false;
+  pando::GlobalPtr<pando::Vector<int64_t>> vhosts_per_host =
+      static_cast<pando::GlobalPtr<pando::Vector<int64_t>>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(pando::Vector<int64_t>) *
+                                                          num_hosts));
+  pando::GlobalPtr<EdgeVectorPando> global_vhostEdgesPerHost =
+      static_cast<pando::GlobalPtr<EdgeVectorPando>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(EdgeVectorPando) * size));
+  pando::GlobalPtr<EdgeVectorPando> final_edgelist_per_host =
+      static_cast<pando::GlobalPtr<EdgeVectorPando>>(
+          pando::getDefaultMainMemoryResource()->allocate(sizeof(EdgeVectorPando) * num_hosts));
+
+  // Edge j of vhost v of host h is {h * NUM_VHOSTS_PER_HOST + v, j}
+  for (int64_t h = 0; h < num_hosts; h++) {
+    for (int64_t v = 0; v < NUM_VHOSTS_PER_HOST; v++) {
+      EdgeVectorPando ev = global_vhostEdgesPerHost[h * NUM_VHOSTS_PER_HOST + v];
+      PANDO_CHECK(ev.initialize(vhost_num_edges(h, v)));
+      for (size_t j = 0; j < ev.size(); j++)
+        ev[j] = Edge{h * NUM_VHOSTS_PER_HOST + v, static_cast<int64_t>(j)};
+      global_vhostEdgesPerHost[h * NUM_VHOSTS_PER_HOST + v] = std::move(ev);
+    }
+  }
+  // vhost v is assigned to host v % num_hosts
+  for (int64_t i = 0; i < num_hosts; i++) {
+    pando::Vector<int64_t> vhosts_host_i = vhosts_per_host[i];
+    PANDO_CHECK(vhosts_host_i.initialize(0));
+    for (int64_t v = i; v < NUM_VHOSTS_PER_HOST; v += num_hosts)
+      PANDO_CHECK(vhosts_host_i.pushBack(v));
+    vhosts_per_host[i] = std::move(vhosts_host_i);
+  }
+
+  launch_stream_edge_exchange(dones, final_edgelist_per_host, vhosts_per_host,
+                              global_vhostEdgesPerHost, NUM_VHOSTS_PER_HOST);
+
+  // The final edge list of a host holds the edges of its vhosts ordered by source host
+  for (int64_t i = 0; i < num_hosts; i++) {
+    EdgeVectorPando el_hostI = final_edgelist_per_host[i];
+    size_t expected_size = 0;
+    for (int64_t h = 0; h < num_hosts; h++) {
+      for (int64_t v = i; v < NUM_VHOSTS_PER_HOST; v += num_hosts)
+        expected_size += vhost_num_edges(h, v);
+    }
+    EXPECT_EQ(el_hostI.size(), expected_size);
+    size_t pos = 0;
+    for (int64_t h = 0; h < num_hosts && el_hostI.size() == expected_size; h++) {
+      for (int64_t v = i; v < NUM_VHOSTS_PER_HOST; v += num_hosts) {
+        for (size_t j = 0; j < vhost_num_edges(h, v); j++, pos++) {
+          Edge actual_e = el_hostI[pos];
+          EXPECT_EQ(actual_e.src, h * NUM_VHOSTS_PER_HOST + v);
+          EXPECT_EQ(actual_e.dest, static_cast<int64_t>(j));
+        }
+      }
+    }
+    el_hostI.deinitialize();
+  }
+  check_dones_reset(dones);
+
+  for (int64_t i = 0; i < size; i++) {
+    EdgeVectorPando ev = global_vhostEdgesPerHost[i];
+    ev.deinitialize();
+  }
+  for (int64_t i = 0; i < num_hosts; i++) {
+    pando::Vector<int64_t> vhosts_host_i = vhosts_per_host[i];
+    vhosts_host_i.deinitialize();
+  }
+  pando::deallocateMemory(dones, num_hosts);
+  pando::deallocateMemory(vhosts_per_host, num_hosts);
+  pando::deallocateMemory(global_vhostEdgesPerHost, size);
+  pando::deallocateMemory(final_edgelist_per_host, num_hosts);
+  hb_done.notify();
+}
+
 TEST(TriangleCount, SimpleRRLocalELs) {
   int64_t num_hosts = pando::getPlaceDims().node.id;
   int64_t required_num_hosts = 3;
@@ -495,3 +677,22 @@ TEST(TriangleCount, SimpleEdgeExchange) {
     necessary.wait();
   }
 }
+
+TEST(TriangleCount, SimpleStreamEdgeExchange) {
+  int64_t num_hosts = pando::getPlaceDims().node.id;
+  int64_t required_num_hosts = 3;
+  if (num_hosts == required_num_hosts) {
+    pando::Notification necessary;
+    PANDO_CHECK(pando::executeOn(pando::Place{pando::NodeIndex{0}, pando::anyPod, pando::anyCore},
+                                 &run_test_launch_stream_edge_exchange, necessary.getHandle()));
+    necessary.wait();
+  }
+}
+
+TEST(TriangleCount, LargeStreamEdgeExchange) {
+  pando::Notification necessary;
+  PANDO_CHECK(pando::executeOn(pando::Place{pando::NodeIndex{0}, pando::anyPod, pando::anyCore},
+                               &run_test_launch_stream_edge_exchange_large,
+                               necessary.getHandle()));
+  necessary.wait();
+}
@@ -292,6 +292,143 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple("/pando/graphs/rmat_571919_seed1_scale17_nV131072_nE1864704.el", 131072),
         std::make_tuple("/pando/graphs/rmat_571919_seed1_scale18_nV262144_nE3806162.el", 262144)));
 
+class DLCSRInitEdgeBalancedRanges
+    : public ::testing::TestWithParam<std::tuple<const char*, std::uint64_t>> {};
+TEST_P(DLCSRInitEdgeBalancedRanges, perHostEdges) {
+  using ET = galois::ELEdge;
+  using VT = galois::ELVertex;
+  using Graph = galois::DistLocalCSR<VT, ET>;
+
+  const std::string elFile = std::get<0>(GetParam());
+  const std::uint64_t numVertices = std::get<1>(GetParam());
+
+  pando::Array<char> filename;
+  EXPECT_EQ(pando::Status::Success, filename.initialize(elFile.size()));
+  for (uint64_t i = 0; i < elFile.size(); i++)
+    filename[i] = elFile[i];
+
+  Graph graph = galois::initializeELDLCSR<Graph, galois::ELVertex, galois::ELEdge>(
+      filename, numVertices, 8, galois::VirtualHostPolicy::EdgeBalancedRanges);
+
+  std::unordered_map<std::uint64_t, std::vector<std::uint64_t>> goldenTable;
+  getVerticesAndEdgesEL(elFile, numVertices, goldenTable);
+  EXPECT_EQ(goldenTable.size(), graph.size());
+
+  const std::uint64_t numHosts = static_cast<std::uint64_t>(pando::getPlaceDims().node.id);
+  std::vector<std::uint64_t> hostEdges(numHosts, 0);
+  std::vector<std::uint64_t> hostVertices(numHosts, 0);
+  std::vector<std::uint64_t> hostMinToken(numHosts, numVertices);
+  std::vector<std::uint64_t> hostMaxToken(numHosts, 0);
+  std::uint64_t totalEdges = 0;
+  std::uint64_t maxDegree = 0;
+  for (typename Graph::VertexTopologyID vert : graph.vertices()) {
+    const std::uint64_t host = static_cast<std::uint64_t>(localityOf(vert).node.id);
+    const typename Graph::VertexTokenID tok = graph.getTokenID(vert);
+    EXPECT_EQ(graph.getPhysicalHostID(tok), host);
+    EXPECT_EQ(goldenTable[tok].size(), graph.getNumEdges(vert));
+    hostEdges[host] += graph.getNumEdges(vert);
+    hostVertices[host]++;
+    hostMinToken[host] = std::min(hostMinToken[host], tok);
+    hostMaxToken[host] = std::max(hostMaxToken[host], tok);
+    totalEdges += graph.getNumEdges(vert);
+    maxDegree = std::max(maxDegree, graph.getNumEdges(vert));
+  }
+
+  // every host owns a contiguous range of ids with about 1/numHosts of the edges
+  for (std::uint64_t host = 0; host < numHosts; host++) {
+    EXPECT_LE(hostEdges[host], totalEdges / numHosts + maxDegree);
+    if (hostVertices[host] != 0) {
+      EXPECT_EQ(hostMaxToken[host] - hostMinToken[host] + 1, hostVertices[host]);
+    }
+    if (host > 0 && hostVertices[host - 1] != 0 && hostVertices[host] != 0) {
+      EXPECT_EQ(hostMaxToken[host - 1] + 1, hostMinToken[host]);
+    }
+  }
+
+  filename.deinitialize();
+  graph.deinitialize();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SmallFiles, DLCSRInitEdgeBalancedRanges,
+    ::testing::Values(std::make_tuple("/pando/graphs/simple.el", 10),
+                      std::make_tuple("/pando/graphs/rmat_571919_seed1_scale10_nV1024_nE10447.el",
+                                      1024)));
+
+class DLCSRTopologyIDs : public ::testing::TestWithParam<std::tuple<const char*, std::uint64_t>> {
+};
+TEST_P(DLCSRTopologyIDs, batchedResolution) {
+  using ET = galois::ELEdge;
+  using VT = galois::ELVertex;
+  using Graph = galois::DistLocalCSR<VT, ET>;
+
+  const std::string elFile = std::get<0>(GetParam());
+  const std::uint64_t numVertices = std::get<1>(GetParam());
+
+  pando::Array<char> filename;
+  EXPECT_EQ(pando::Status::Success, filename.initialize(elFile.size()));
+  for (uint64_t i = 0; i < elFile.size(); i++)
+    filename[i] = elFile[i];
+
+  Graph graph =
+      galois::initializeELDLCSR<Graph, galois::ELVertex, galois::ELEdge>(filename, numVertices);
+
+  pando::Array<typename Graph::VertexTokenID> tokens;
+  EXPECT_EQ(pando::Status::Success, tokens.initialize(numVertices));
+  // reverse order so the batch interleaves hosts
+  for (std::uint64_t i = 0; i < numVertices; i++) {
+    tokens[i] = numVertices - 1 - i;
+  }
+  pando::Array<typename Graph::VertexTopologyID> topologyIDs;
+  EXPECT_EQ(pando::Status::Success, topologyIDs.initialize(numVertices));
+
+  EXPECT_EQ(pando::Status::Success,
+            graph.getTopologyIDs(pando::Span<typename Graph::VertexTokenID>(tokens.begin(),
+                                                                            tokens.size()),
+                                 pando::Span<typename Graph::VertexTopologyID>(
+                                     topologyIDs.begin(), topologyIDs.size())));
+  for (std::uint64_t i = 0; i < numVertices; i++) {
+    typename Graph::VertexTopologyID topologyID = topologyIDs[i];
+    EXPECT_EQ(graph.getTopologyID(tokens[i]), topologyID);
+    EXPECT_EQ(graph.getTokenID(topologyID), tokens[i]);
+  }
+
+  // copies of the graph share the directory
+  Graph copy = graph;
+  EXPECT_FALSE(copy.hasTopologyDirectory());
+  EXPECT_EQ(pando::Status::Success, graph.buildTopologyDirectory());
+  EXPECT_TRUE(copy.hasTopologyDirectory());
+  topologyIDs.fill(nullptr);
+  EXPECT_EQ(pando::Status::Success,
+            graph.getTopologyIDs(pando::Span<typename Graph::VertexTokenID>(tokens.begin(),
+                                                                            tokens.size()),
+                                 pando::Span<typename Graph::VertexTopologyID>(
+                                     topologyIDs.begin(), topologyIDs.size())));
+  for (std::uint64_t i = 0; i < numVertices; i++) {
+    typename Graph::VertexTopologyID topologyID = topologyIDs[i];
+    EXPECT_EQ(graph.getTopologyID(tokens[i]), topologyID);
+    EXPECT_EQ(graph.getTokenID(topologyID), tokens[i]);
+    EXPECT_EQ(copy.getTopologyID(tokens[i]), topologyID);
+  }
+  copy.deinitializeTopologyDirectory();
+  EXPECT_FALSE(graph.hasTopologyDirectory());
+  for (std::uint64_t i = 0; i < numVertices; i++) {
+    EXPECT_EQ(graph.getTopologyID(tokens[i]), topologyIDs[i]);
+    EXPECT_EQ(copy.getTopologyID(tokens[i]), topologyIDs[i]);
+  }
+
+  tokens.deinitialize();
+  topologyIDs.deinitialize();
+  filename.deinitialize();
+  graph.deinitialize();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SmallFiles, DLCSRTopologyIDs,
+    ::testing::Values(std::make_tuple("/pando/graphs/simple.el", 10),
+                      std::make_tuple("/pando/graphs/rmat_571919_seed1_scale10_nV1024_nE10447.el",
+                                      1024)));
+
 class MirrorDLCSRInitEdgeList
     : public ::testing::TestWithParam<std::tuple<const char*, std::uint64_t>> {};
 TEST_P(MirrorDLCSRInitEdgeList, initializeEL) {
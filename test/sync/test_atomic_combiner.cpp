@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#include <gtest/gtest.h>
+#include <pando-rt/export.h>
+
+#include <cstdint>
+
+#include <pando-lib-galois/loops/do_all.hpp>
+#include <pando-lib-galois/sync/atomic_combiner.hpp>
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/memory/allocate_memory.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+namespace {
+
+constexpr std::uint64_t numTargets = 40;
+
+pando::GlobalPtr<std::int64_t> allocateTargets(std::int64_t value) {
+  auto targets = PANDO_EXPECT_CHECK(
+      pando::allocateMemory<std::int64_t>(numTargets, pando::getCurrentPlace(),
+                                          pando::MemoryType::Main));
+  for (std::uint64_t i = 0; i < numTargets; i++) {
+    targets[i] = value;
+  }
+  return targets;
+}
+
+} // namespace
+
+TEST(AtomicCombiner, Add) {
+  auto targets = allocateTargets(0);
+  {
+    galois::AtomicCombiner<std::int64_t, galois::AddCombine<std::int64_t>> combiner;
+    for (std::uint64_t round = 0; round < 5; round++) {
+      for (std::uint64_t i = 0; i < numTargets; i++) {
+        combiner.update(targets + i, static_cast<std::int64_t>(i));
+      }
+    }
+    combiner.flush();
+    for (std::uint64_t i = 0; i < numTargets; i++) {
+      EXPECT_EQ(targets[i], static_cast<std::int64_t>(5 * i));
+    }
+    combiner.update(targets, 1);
+  }
+  // the destructor sends the pending updates
+  EXPECT_EQ(targets[0], 1);
+  pando::deallocateMemory(targets, numTargets);
+}
+
+TEST(AtomicCombiner, MinMax) {
+  auto minTargets = allocateTargets(100);
+  auto maxTargets = allocateTargets(-100);
+  {
+    galois::AtomicCombiner<std::int64_t, galois::MinCombine<std::int64_t>, 4> minCombiner;
+    galois::AtomicCombiner<std::int64_t, galois::MaxCombine<std::int64_t>, 4> maxCombiner;
+    for (std::int64_t value = -10; value <= 10; value++) {
+      for (std::uint64_t i = 0; i < numTargets; i++) {
+        minCombiner.update(minTargets + i, value + static_cast<std::int64_t>(i));
+        maxCombiner.update(maxTargets + i, value - static_cast<std::int64_t>(i));
+      }
+    }
+  }
+  for (std::uint64_t i = 0; i < numTargets; i++) {
+    EXPECT_EQ(minTargets[i], -10 + static_cast<std::int64_t>(i));
+    EXPECT_EQ(maxTargets[i], 10 - static_cast<std::int64_t>(i));
+  }
+  pando::deallocateMemory(minTargets, numTargets);
+  pando::deallocateMemory(maxTargets, numTargets);
+}
+
+TEST(AtomicCombiner, Parallel) {
+  auto targets = allocateTargets(0);
+  const std::uint64_t numTasks = 64;
+  pando::Array<std::uint64_t> work;
+  EXPECT_EQ(work.initialize(numTasks), pando::Status::Success);
+  EXPECT_EQ(galois::doAll(
+                targets, work,
+                +[](pando::GlobalPtr<std::int64_t> targets, pando::GlobalRef<std::uint64_t>) {
+                  galois::AtomicCombiner<std::int64_t, galois::AddCombine<std::int64_t>> combiner;
+                  for (std::uint64_t i = 0; i < 4 * numTargets; i++) {
+                    combiner.update(targets + (i % numTargets), 1);
+                  }
+                }),
+            pando::Status::Success);
+  for (std::uint64_t i = 0; i < numTargets; i++) {
+    EXPECT_EQ(targets[i], static_cast<std::int64_t>(4 * numTasks));
+  }
+  work.deinitialize();
+  pando::deallocateMemory(targets, numTargets);
+}
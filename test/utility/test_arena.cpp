@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "pando-rt/export.h"
+#include <pando-lib-galois/utility/arena.hpp>
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/pando-rt.hpp>
+
+TEST(Arena, Init) {
+  galois::Arena arena;
+  EXPECT_EQ(arena.allocate<std::uint64_t>(1), nullptr);
+  EXPECT_EQ(arena.mark(), 0);
+
+  EXPECT_EQ(arena.initialize(1024), pando::Status::Success);
+  EXPECT_EQ(arena.mark(), 0);
+  pando::GlobalPtr<std::uint64_t> ptr = arena.allocate<std::uint64_t>(128);
+  EXPECT_NE(ptr, nullptr);
+  EXPECT_EQ(pando::memoryTypeOf(ptr), pando::MemoryType::Main);
+  for (std::uint64_t i = 0; i < 128; i++) {
+    ptr[i] = i;
+  }
+  for (std::uint64_t i = 0; i < 128; i++) {
+    EXPECT_EQ(ptr[i], i);
+  }
+  EXPECT_EQ(arena.allocate<std::uint64_t>(128), nullptr);
+  arena.deinitialize();
+}
+
+TEST(Arena, L2SP) {
+  const auto thisPlace = pando::getCurrentPlace();
+  const pando::Place place{thisPlace.node, pando::anyPod, pando::anyCore};
+
+  galois::Arena arena;
+  EXPECT_EQ(arena.initialize(256, place, pando::MemoryType::L2SP), pando::Status::Success);
+  pando::GlobalPtr<std::uint64_t> ptr = arena.allocate<std::uint64_t>(16);
+  EXPECT_NE(ptr, nullptr);
+  EXPECT_EQ(pando::memoryTypeOf(ptr), pando::MemoryType::L2SP);
+  arena.deinitialize();
+}
+
+TEST(Arena, ExternalBuffer) {
+  pando::Array<std::byte> buffer;
+  EXPECT_EQ(buffer.initialize(512), pando::Status::Success);
+
+  galois::Arena arena;
+  EXPECT_EQ(arena.initialize(buffer.data(), 1), pando::Status::InvalidValue);
+  EXPECT_EQ(arena.initialize(buffer.data(), buffer.size()), pando::Status::Success);
+  pando::GlobalPtr<std::uint64_t> ptr = arena.allocate<std::uint64_t>(8);
+  EXPECT_NE(ptr, nullptr);
+  EXPECT_GE(static_cast<pando::GlobalPtr<std::byte>>(static_cast<pando::GlobalPtr<void>>(ptr)),
+            buffer.data());
+  arena.deinitialize();
+
+  buffer.deinitialize();
+}
+
+TEST(Arena, ScopedRegion) {
+  galois::Arena arena;
+  EXPECT_EQ(arena.initialize(1024), pando::Status::Success);
+
+  pando::GlobalPtr<std::uint64_t> outer = arena.allocate<std::uint64_t>(8);
+  EXPECT_NE(outer, nullptr);
+  const std::uint64_t mark = arena.mark();
+  pando::GlobalPtr<std::uint64_t> first;
+  {
+    galois::ScopedRegion region(arena);
+    pando::Span<std::uint64_t> span;
+    EXPECT_EQ(arena.allocateSpan(16, span), pando::Status::Success);
+    EXPECT_EQ(span.size(), 16);
+    first = span.data();
+    {
+      galois::ScopedRegion inner(arena);
+      EXPECT_NE(arena.allocate<std::uint64_t>(16), nullptr);
+    }
+    EXPECT_EQ(arena.allocate<std::uint64_t>(16), first + 16);
+  }
+  EXPECT_EQ(arena.mark(), mark);
+  EXPECT_EQ(arena.allocate<std::uint64_t>(16), first);
+
+  arena.reset();
+  EXPECT_EQ(arena.mark(), 0);
+  EXPECT_EQ(arena.allocate<std::uint64_t>(8), outer);
+  arena.deinitialize();
+}
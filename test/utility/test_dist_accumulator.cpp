@@ -66,3 +66,45 @@ TEST(DistAccumulator, Distributed) {
   sum.reset();
   EXPECT_EQ(sum.get(), 0);
 }
+
+TEST(DistAccumulator, RepeatedReduce) {
+  const uint64_t workItemsPerHost = 100;
+  const uint64_t pxns = pando::getPlaceDims().node.id;
+  galois::DistArray<uint64_t> distributedWork = getDistributedWorkArray(workItemsPerHost);
+  galois::DAccumulator<uint64_t> sum{};
+  EXPECT_EQ(sum.initialize(), pando::Status::Success);
+
+  galois::doAll(
+      sum, distributedWork, +[](galois::DAccumulator<uint64_t> sum, pando::GlobalRef<uint64_t>) {
+        sum.add(3);
+        sum.subtract(1);
+      });
+  EXPECT_EQ(sum.reduce(), workItemsPerHost * pxns * 2);
+  EXPECT_EQ(sum.reduce(), workItemsPerHost * pxns * 2);
+
+  galois::doAll(
+      sum, distributedWork, +[](galois::DAccumulator<uint64_t> sum, pando::GlobalRef<uint64_t>) {
+        sum.increment();
+      });
+  EXPECT_EQ(sum.reduce(), workItemsPerHost * pxns * 3);
+  sum.deinitialize();
+}
+
+TEST(DistAccumulator, Flush) {
+  const uint64_t workItemsPerHost = 100;
+  const uint64_t pxns = pando::getPlaceDims().node.id;
+  galois::DistArray<uint64_t> distributedWork = getDistributedWorkArray(workItemsPerHost);
+  galois::DAccumulator<uint64_t> sum{};
+  EXPECT_EQ(sum.initialize(), pando::Status::Success);
+
+  galois::doAll(
+      sum, distributedWork, +[](galois::DAccumulator<uint64_t> sum, pando::GlobalRef<uint64_t>) {
+        sum.increment();
+        sum.flush();
+        sum.increment();
+      });
+  EXPECT_EQ(sum.reduce(), workItemsPerHost * pxns * 2);
+  sum.reset();
+  EXPECT_EQ(sum.reduce(), 0);
+  sum.deinitialize();
+}
@@ -239,3 +239,24 @@ TEST(PANDO_EXPECT_RETURN, Fail) {
   };
   EXPECT_EQ(pando::Status::NotImplemented, returnFailure());
 }
+
+TEST(FieldOf, Members) {
+  struct Pair {
+    std::uint32_t first;
+    std::uint64_t second;
+  };
+  auto expect = pando::allocateMemory<Pair>(1, pando::getCurrentPlace(), pando::MemoryType::Main);
+  if (!expect.hasValue()) {
+    PANDO_CHECK(expect.error());
+  }
+  pando::GlobalPtr<Pair> ptr = expect.value();
+  *ptr = Pair{1, 2};
+  EXPECT_EQ(galois::offsetOfMember(&Pair::second), offsetof(Pair, second));
+  EXPECT_EQ(galois::fieldOf(*ptr, &Pair::first), 1u);
+  EXPECT_EQ(galois::fieldOf(*ptr, &Pair::second), 2u);
+  galois::fieldOf(*ptr, &Pair::second) = 3;
+  Pair pair = *ptr;
+  EXPECT_EQ(pair.first, 1u);
+  EXPECT_EQ(pair.second, 3u);
+  pando::deallocateMemory(ptr, 1);
+}
@@ -125,11 +125,19 @@ void wf4::internal::RemoveReachableSetWithInfluentialNode(
     pando::GlobalRef<pando::Vector<wf4::NetworkGraph::VertexTokenID>> reachability_set_ref) {
   pando::Vector<wf4::NetworkGraph::VertexTokenID> reachability_set = reachability_set_ref;
   if (vectorContains(reachability_set, state.influential_node)) {
-    for (wf4::NetworkGraph::VertexTokenID reachable_node_gid : reachability_set) {
-      wf4::NetworkNode node_data =
-          state.graph.getData(state.graph.getTopologyID(reachable_node_gid));
-      pando::atomicDecrement(node_data.frequency_, 1, std::memory_order_relaxed);
+    pando::Array<wf4::NetworkGraph::VertexTopologyID> reachable_node_lids;
+    PANDO_CHECK(reachable_node_lids.initialize(reachability_set.size()));
+    PANDO_CHECK(state.graph.getTopologyIDs(
+        pando::Span<wf4::NetworkGraph::VertexTokenID>(reachability_set.data(),
+                                                      reachability_set.size()),
+        pando::Span<wf4::NetworkGraph::VertexTopologyID>(reachable_node_lids.begin(),
+                                                         reachable_node_lids.size())));
+    for (wf4::NetworkGraph::VertexTopologyID reachable_node_lid : reachable_node_lids) {
+      pando::GlobalPtr<std::uint64_t> frequency =
+          state.graph.getField<&wf4::NetworkNode::frequency_>(reachable_node_lid);
+      pando::atomicDecrement(frequency, 1, std::memory_order_relaxed);
     }
+    reachable_node_lids.deinitialize();
     reachability_set.deinitialize();
     reachability_set_ref = reachability_set;
   }
@@ -153,8 +161,9 @@ void wf4::internal::RemoveReachableSetsWithInfluentialNode(
 
 void wf4::internal::FindLocalMaxNode(wf4::internal::MaxState& state,
                                      wf4::NetworkGraph::VertexTopologyID node) {
-  wf4::NetworkNode node_data = state.graph.getData(node);
-  uint64_t influence = *node_data.frequency_;
+  pando::GlobalPtr<std::uint64_t> frequency =
+      state.graph.getField<&wf4::NetworkNode::frequency_>(node);
+  uint64_t influence = *frequency;
   state.total_influence.add(influence);
   pando::Vector<LocalMaxNode> local_vec = state.max_array.getThreadVector();
   if (local_vec.size() == 0) {
@@ -201,8 +210,9 @@ void wf4::internal::GenerateRandomReversibleReachableSet(wf4::internal::RRRState
     wf4::NetworkGraph::VertexTokenID node_gid;
     PANDO_CHECK(frontier.pop(node_gid));
     wf4::NetworkGraph::VertexTopologyID node_lid = state.graph.getTopologyID(node_gid);
-    wf4::NetworkNode node = state.graph.getData(node_lid);
-    pando::atomicIncrement(node.frequency_, 1, std::memory_order_relaxed);
+    pando::GlobalPtr<std::uint64_t> frequency =
+        state.graph.getField<&wf4::NetworkNode::frequency_>(node_lid);
+    pando::atomicIncrement(frequency, 1, std::memory_order_relaxed);
     for (auto edge : state.graph.edges(node_lid)) {
       wf4::NetworkEdge edge_data = state.graph.getEdgeData(edge);
       if (dist_bfs(generator) <= edge_data.weight_) {
@@ -237,8 +247,8 @@ void wf4::internal::FillNodeValues(wf4::NetworkGraph& graph,
 
 void wf4::internal::CalculateEdgeProbability(EdgeProbabilityState& state,
                                              const wf4::NetworkGraph::VertexTopologyID& node) {
-  NetworkNode node_data = state.graph.getData(node);
-  double amount_sold = *node_data.sold_;
+  pando::GlobalPtr<double> sold = state.graph.getField<&NetworkNode::sold_>(node);
+  double amount_sold = *sold;
   for (auto edge_handle : state.graph.edges(node)) {
     NetworkEdge edge = state.graph.getEdgeData(edge_handle);
 
@@ -248,9 +258,11 @@ void wf4::internal::CalculateEdgeProbability(EdgeProbabilityState& state,
       state.graph.setEdgeData(edge_handle, edge);
       state.total_edge_weights.add(edge.weight_);
     } else if (edge.type == agile::TYPES::PURCHASE) {
-      NetworkNode dst_data = state.graph.getData(state.graph.getEdgeDst(edge_handle));
-      if (*dst_data.sold_ > 0) {
-        edge.weight_ = edge.amount_ / *dst_data.sold_;
+      pando::GlobalPtr<double> dst_sold =
+          state.graph.getField<&NetworkNode::sold_>(state.graph.getEdgeDst(edge_handle));
+      double dst_amount_sold = *dst_sold;
+      if (dst_amount_sold > 0) {
+        edge.weight_ = edge.amount_ / dst_amount_sold;
         state.graph.setEdgeData(edge_handle, edge);
         state.total_edge_weights.add(edge.weight_);
       }
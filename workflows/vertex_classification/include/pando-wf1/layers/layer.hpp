@@ -15,6 +15,7 @@
 #include <pando-lib-galois/loops/do_all.hpp>
 
 #include <pando-wf1/gnntypes.hpp>
+#include <pando-wf1/math/elementwise.hpp>
 #include <pando-wf1/optimizer.hpp>
 
 namespace gnn {
@@ -171,26 +172,12 @@ public:
     GNNFloat dropoutRate{0.5};
     GNNFloat scale{1.f / (1.f - dropoutRate)};
 
-    struct Tpl {
-      RandomNumberGenerator dropoutSampler;
-      GNNFloat dropoutRate;
-    };
-    // Sample drop-out masks based on the Bernoulli method
-    galois::doAll(
-        Tpl{this->dropoutSampler_, dropoutRate}, this->dropoutMask_,
-        +[](Tpl tpl, pando::Array<bool> mask) {
-          galois::doAll(
-              tpl, mask, +[](Tpl tpl, pando::GlobalRef<bool> v) {
-                RandomNumberGenerator dropoutSampler = tpl.dropoutSampler;
-                GNNFloat dropoutRate = tpl.dropoutRate;
-                v = dropoutSampler.DoBernoulli(dropoutRate);
-              });
-        });
-
     struct OutTpl {
       galois::HostLocalStorage<GNNLayerDimensions> dimensions;
       galois::HostLocalStorage<pando::Array<GNNFloat>> outEmbed;
       galois::HostLocalStorage<pando::Array<GNNFloat>> inEmbed;
+      RandomNumberGenerator dropoutSampler;
+      GNNFloat dropoutRate;
       GNNFloat scale;
     };
 
@@ -198,12 +185,16 @@ public:
       pando::Array<GNNFloat> outEmbed;
       pando::Array<GNNFloat> inEmbed;
       pando::Array<bool> mask;
+      RandomNumberGenerator dropoutSampler;
+      GNNFloat dropoutRate;
       GNNFloat scale;
     };
 
+    // Sample drop-out masks based on the Bernoulli method and apply them in the same pass
     galois::doAll(
-        OutTpl{this->dimensions_, outputMatrix, inputToDropout, scale}, this->dropoutMask_,
-        +[](OutTpl tpl, pando::GlobalRef<pando::Array<bool>> maskRef) {
+        OutTpl{this->dimensions_, outputMatrix, inputToDropout, this->dropoutSampler_, dropoutRate,
+               scale},
+        this->dropoutMask_, +[](OutTpl tpl, pando::GlobalRef<pando::Array<bool>> maskRef) {
           std::uint32_t host = pando::getCurrentPlace().node.id;
 
           GNNLayerDimensions dimension = *fmap(tpl.dimensions, get, host);
@@ -211,19 +202,20 @@ public:
           pando::Array<GNNFloat> inEmbed = *fmap(tpl.inEmbed, get, host);
           LayerDimension indexRange = dimension.inputColumns * dimension.inputRows;
 
-          galois::doAll(
-              InnerTpl{outEmbed, inEmbed, maskRef, tpl.scale}, galois::IotaRange(0, indexRange),
-              +[](InnerTpl tpl, LayerDimension i) {
-                pando::Array<GNNFloat> outEmbed = tpl.outEmbed;
-                pando::Array<GNNFloat> inEmbed = tpl.inEmbed;
-                pando::Array<bool> mask = tpl.mask;
-                GNNFloat scale = tpl.scale;
-                if (mask[i] == 1) {
-                  outEmbed[i] = inEmbed[i] * scale;
-                } else {
-                  outEmbed[i] = 0;
+          PANDO_CHECK(doAllBlocks(
+              InnerTpl{outEmbed, inEmbed, maskRef, tpl.dropoutSampler, tpl.dropoutRate, tpl.scale},
+              indexRange, +[](InnerTpl& tpl, LayerDimension offset, LayerDimension n) {
+                ElementBlock<GNNFloat> in;
+                ElementBlock<GNNFloat> out;
+                ElementBlock<bool> mask;
+                loadBlock(tpl.inEmbed.data() + offset, in, n);
+                for (LayerDimension i = 0; i < n; ++i) {
+                  mask[i] = tpl.dropoutSampler.DoBernoulli(tpl.dropoutRate);
+                  out[i] = mask[i] ? in[i] * tpl.scale : GNNFloat{0};
                 }
-              });
+                storeBlock(tpl.mask.data() + offset, mask, n);
+                storeBlock(tpl.outEmbed.data() + offset, out, n);
+              }));
         });
 
 #if 0
@@ -272,24 +264,22 @@ public:
 
           pando::Array<GNNFloat> fwOut = *fmap(fwOuts, get, host);
 
-          pando::Array<bool> reluAct = reluActRef;
-          // Reset a ReLU activation matrix
-          galois::doAll(
-              reluAct, +[](pando::GlobalRef<bool> v) {
-                v = false;
-              });
-
-          galois::doAll(
-              InnerTpl{fwOut, reluActRef}, galois::IotaRange(0, fwOut.size()),
-              +[](InnerTpl tpl, LayerDimension i) {
-                pando::GlobalRef<GNNFloat> v = tpl.fwOut[i];
-                pando::GlobalRef<bool> activated = tpl.reluAct[i];
-                if (v > GNNFloat{0}) {
-                  activated = true;
-                } else {
-                  v = 0;
+          // Resetting the activation matrix and activating are done in one pass
+          PANDO_CHECK(doAllBlocks(
+              InnerTpl{fwOut, reluActRef}, fwOut.size(),
+              +[](InnerTpl& tpl, LayerDimension offset, LayerDimension n) {
+                ElementBlock<GNNFloat> v;
+                ElementBlock<bool> activated;
+                loadBlock(tpl.fwOut.data() + offset, v, n);
+                for (LayerDimension i = 0; i < n; ++i) {
+                  activated[i] = v[i] > GNNFloat{0};
+                  if (!activated[i]) {
+                    v[i] = 0;
+                  }
                 }
-              });
+                storeBlock(tpl.fwOut.data() + offset, v, n);
+                storeBlock(tpl.reluAct.data() + offset, activated, n);
+              }));
         });
 
 #if 0
@@ -313,12 +303,19 @@ public:
   void LeakyReLUActivation() {
     galois::doAll(
         this->forwardOutputMatrix_, +[](pando::GlobalRef<pando::Array<GNNFloat>> fwOut) {
-          galois::doAll(
-              fwOut, +[](pando::GlobalRef<GNNFloat> v) {
-                if (v < GNNFloat{0}) {
-                  v = 0.01 * v;
+          pando::Array<GNNFloat> fwOutArr = fwOut;
+          PANDO_CHECK(doAllBlocks(
+              fwOutArr, fwOutArr.size(),
+              +[](pando::Array<GNNFloat>& fwOut, LayerDimension offset, LayerDimension n) {
+                ElementBlock<GNNFloat> v;
+                loadBlock(fwOut.data() + offset, v, n);
+                for (LayerDimension i = 0; i < n; ++i) {
+                  if (v[i] < GNNFloat{0}) {
+                    v[i] = 0.01 * v[i];
+                  }
                 }
-              });
+                storeBlock(fwOut.data() + offset, v, n);
+              }));
         });
   }
 
@@ -370,14 +367,21 @@ public:
           LayerDimension outMatDim = dim.outputRows * dim.outputColumns;
           pando::Array<bool> mask = *fmap(tpl.mask, get, host);
 
-          galois::doAll(
-              InnerTpl{mask, gradRef}, galois::IotaRange(0, outMatDim),
-              +[](InnerTpl tpl, LayerDimension i) {
-                // ReLU inactivated this feature, and so does not reflect its gradient
-                if (!tpl.mask[i]) {
-                  tpl.grad[i] = 0;
+          PANDO_CHECK(doAllBlocks(
+              InnerTpl{mask, gradRef}, outMatDim,
+              +[](InnerTpl& tpl, LayerDimension offset, LayerDimension n) {
+                ElementBlock<bool> mask;
+                ElementBlock<GNNFloat> grad;
+                loadBlock(tpl.mask.data() + offset, mask, n);
+                loadBlock(tpl.grad.data() + offset, grad, n);
+                for (LayerDimension i = 0; i < n; ++i) {
+                  // ReLU inactivated this feature, and so does not reflect its gradient
+                  if (!mask[i]) {
+                    grad[i] = 0;
+                  }
                 }
-              });
+                storeBlock(tpl.grad.data() + offset, grad, n);
+              }));
         });
 #if 0
     for (std::uint32_t host = 0; host < static_cast<std::uint32_t>(pando::getPlaceDims().node.id);
@@ -417,15 +421,18 @@ public:
 
           LayerDimension inMatDim = dim.inputColumns * dim.inputRows;
 
-          galois::doAll(
-              InnerTpl{outMatRef, mask}, galois::IotaRange(0, inMatDim),
-              +[](InnerTpl tpl, LayerDimension i) {
-                if (tpl.mask[i]) {
-                  tpl.outMat[i] = tpl.outMat[i] * 2;
-                } else {
-                  tpl.outMat[i] = 0;
+          PANDO_CHECK(doAllBlocks(
+              InnerTpl{outMatRef, mask}, inMatDim,
+              +[](InnerTpl& tpl, LayerDimension offset, LayerDimension n) {
+                ElementBlock<GNNFloat> outMat;
+                ElementBlock<bool> mask;
+                loadBlock(tpl.outMat.data() + offset, outMat, n);
+                loadBlock(tpl.mask.data() + offset, mask, n);
+                for (LayerDimension i = 0; i < n; ++i) {
+                  outMat[i] = mask[i] ? outMat[i] * 2 : GNNFloat{0};
                 }
-              });
+                storeBlock(tpl.outMat.data() + offset, outMat, n);
+              }));
         });
   }
 
@@ -10,6 +10,7 @@
 #include <pando-lib-galois/loops/do_all.hpp>
 #include <pando-rt/containers/vector.hpp>
 #include <pando-wf1/layers/layer.hpp>
+#include <pando-wf1/math/elementwise.hpp>
 
 namespace gnn {
 
@@ -83,24 +84,48 @@ public:
               +[](InnerTpl tpl, LayerDimension i) {
                 // Get an inferred vertex class
                 std::uint64_t numClasses = tpl.numClasses;
+                // Stage the row in native memory one block at a time; a row that fits in one
+                // block stays staged between the passes, so it is read once and written once
+                const bool oneBlock = numClasses <= ELEMENTWISE_BLOCK_SIZE;
+                pando::GlobalPtr<GNNFloat> in = tpl.inMat.data() + i * numClasses;
+                pando::GlobalPtr<GNNFloat> out = tpl.outMat.data() + i * numClasses;
+                ElementBlock<GNNFloat> block;
+
                 GNNFloat maxElem{-std::numeric_limits<GNNFloat>::max()};
-                for (std::uint64_t f = 0; f < numClasses; ++f) {
-                  if (tpl.inMat[i * numClasses + f] > maxElem) {
-                    maxElem = tpl.inMat[i * numClasses + f];
+                for (std::uint64_t f = 0; f < numClasses; f += ELEMENTWISE_BLOCK_SIZE) {
+                  const LayerDimension n = std::min(ELEMENTWISE_BLOCK_SIZE, numClasses - f);
+                  loadBlock(in + f, block, n);
+                  for (LayerDimension k = 0; k < n; ++k) {
+                    maxElem = std::max(maxElem, block[k]);
                   }
                 }
 
                 GNNFloat denom{0};
-                for (std::uint64_t f = 0; f < numClasses; ++f) {
-                  tpl.outMat[i * numClasses + f] =
-                      std::exp(tpl.inMat[i * numClasses + f] - maxElem);
-                  denom += tpl.outMat[i * numClasses + f];
+                for (std::uint64_t f = 0; f < numClasses; f += ELEMENTWISE_BLOCK_SIZE) {
+                  const LayerDimension n = std::min(ELEMENTWISE_BLOCK_SIZE, numClasses - f);
+                  if (!oneBlock) {
+                    loadBlock(in + f, block, n);
+                  }
+                  for (LayerDimension k = 0; k < n; ++k) {
+                    block[k] = std::exp(block[k] - maxElem);
+                    denom += block[k];
+                  }
+                  if (!oneBlock) {
+                    storeBlock(out + f, block, n);
+                  }
                 }
 
-                if (denom > 0) {
-                  for (std::uint64_t f = 0; f < numClasses; ++f) {
-                    tpl.outMat[i * numClasses + f] /= denom;
+                for (std::uint64_t f = 0; f < numClasses; f += ELEMENTWISE_BLOCK_SIZE) {
+                  const LayerDimension n = std::min(ELEMENTWISE_BLOCK_SIZE, numClasses - f);
+                  if (!oneBlock) {
+                    loadBlock(out + f, block, n);
+                  }
+                  if (denom > 0) {
+                    for (LayerDimension k = 0; k < n; ++k) {
+                      block[k] /= denom;
+                    }
                   }
+                  storeBlock(out + f, block, n);
                 }
               });
         });
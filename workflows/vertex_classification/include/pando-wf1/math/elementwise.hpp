@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#ifndef PANDO_WF1_MATH_ELEMENTWISE_HPP_
+#define PANDO_WF1_MATH_ELEMENTWISE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+
+#include <pando-lib-galois/loops/do_all.hpp>
+#include <pando-rt/containers/array.hpp>
+#include <pando-rt/memory/global_ptr.hpp>
+#include <pando-rt/status.hpp>
+#include <pando-wf1/gnntypes.hpp>
+
+namespace gnn {
+
+/// @brief Number of contiguous elements that an elementwise kernel processes at once
+constexpr LayerDimension ELEMENTWISE_BLOCK_SIZE = 64;
+/// @brief Number of contiguous elements that one task of an elementwise kernel processes
+constexpr LayerDimension ELEMENTWISE_TASK_SIZE = 8 * ELEMENTWISE_BLOCK_SIZE;
+
+/**
+ * @brief A block of contiguous array elements staged in native memory.
+ *
+ * @details A full block is moved from/to the global address space as a single object, so a block
+ * costs one memory request instead of one per element.
+ */
+template <typename T>
+struct ElementBlock {
+  T elements[ELEMENTWISE_BLOCK_SIZE];
+
+  T& operator[](LayerDimension i) noexcept {
+    return elements[i];
+  }
+};
+
+/**
+ * @brief Loads `n` contiguous elements starting at `src` into `dst`.
+ */
+template <typename T>
+void loadBlock(pando::GlobalPtr<T> src, ElementBlock<T>& dst, LayerDimension n) {
+  if (n == ELEMENTWISE_BLOCK_SIZE) {
+    dst = *static_cast<pando::GlobalPtr<ElementBlock<T>>>(static_cast<pando::GlobalPtr<void>>(src));
+    return;
+  }
+  for (LayerDimension i = 0; i < n; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+/**
+ * @brief Stores the first `n` elements of `src` to the contiguous elements starting at `dst`.
+ */
+template <typename T>
+void storeBlock(pando::GlobalPtr<T> dst, const ElementBlock<T>& src, LayerDimension n) {
+  if (n == ELEMENTWISE_BLOCK_SIZE) {
+    *static_cast<pando::GlobalPtr<ElementBlock<T>>>(static_cast<pando::GlobalPtr<void>>(dst)) = src;
+    return;
+  }
+  for (LayerDimension i = 0; i < n; ++i) {
+    dst[i] = src.elements[i];
+  }
+}
+
+/**
+ * @brief Runs an elementwise kernel over `[0, size)` in contiguous blocks.
+ *
+ * @details One task is spawned per `ELEMENTWISE_TASK_SIZE` elements instead of one per element.
+ * Each task calls `kernel(state, offset, n)` for its blocks, where `n <= ELEMENTWISE_BLOCK_SIZE`.
+ * A kernel is expected to stage its operands with `loadBlock`, apply every fused operation in
+ * a plain loop over the native blocks, and write the results back with `storeBlock`.
+ *
+ * @param[in] state  State passed to every kernel invocation
+ * @param[in] size   Number of elements to process
+ * @param[in] kernel Kernel applied to each block
+ */
+template <typename State>
+pando::Status doAllBlocks(State state, LayerDimension size,
+                          void (*kernel)(State&, LayerDimension, LayerDimension)) {
+  using Kernel = void (*)(State&, LayerDimension, LayerDimension);
+  struct Tpl {
+    State state;
+    LayerDimension size;
+    Kernel kernel;
+  };
+
+  const LayerDimension numTasks = (size + ELEMENTWISE_TASK_SIZE - 1) / ELEMENTWISE_TASK_SIZE;
+  return galois::doAll(
+      Tpl{state, size, kernel}, galois::IotaRange(0, numTasks), +[](Tpl tpl, LayerDimension task) {
+        const LayerDimension end = std::min(tpl.size, (task + 1) * ELEMENTWISE_TASK_SIZE);
+        for (LayerDimension offset = task * ELEMENTWISE_TASK_SIZE; offset < end;
+             offset += ELEMENTWISE_BLOCK_SIZE) {
+          tpl.kernel(tpl.state, offset, std::min(ELEMENTWISE_BLOCK_SIZE, end - offset));
+        }
+      });
+}
+
+/**
+ * @brief Sets every element of `array` to `value`.
+ */
+template <typename T>
+pando::Status fillBlocks(pando::Array<T> array, T value) {
+  struct State {
+    pando::Array<T> array;
+    T value;
+  };
+
+  return doAllBlocks(
+      State{array, value}, array.size(), +[](State& state, LayerDimension offset, LayerDimension n) {
+        ElementBlock<T> block;
+        std::fill_n(block.elements, n, state.value);
+        storeBlock(state.array.data() + offset, block, n);
+      });
+}
+
+} // namespace gnn
+
+#endif // PANDO_WF1_MATH_ELEMENTWISE_HPP_
@@ -30,168 +30,202 @@ class MHR {
   using ResultStruct = galois::Pair<float, pando::Vector<std::uint64_t>>;
   using VertexData = typename Graph::VertexData;
 
-  static float computeScore(pando::Vector<std::uint64_t>& path, Graph graph) {
+  /// @brief Parent index of the beam node that starts every path
+  static constexpr std::uint64_t NO_PARENT = UINT64_MAX;
+
+  /**
+   * @brief A path in the beam.
+   *
+   * @details A path is represented by its last vertex, its running score and the index of its
+   * prefix in the beam, so extending a path never copies it.
+   */
+  struct BeamNode {
+    float score;
+    VertexTokenID vertex;
+    std::uint64_t parent;
+    std::uint64_t length;
+  };
+
+  static float computeVertexScore(Graph graph, VertexTokenID id) {
     float score = 0;
-    for (auto id : path) {
-      VertexData v = graph.getData(graph.getTopologyID(id));
-      for (auto val : v.features) {
-        if (val > 0)
-          score += val;
-        else
-          score += -val;
-      }
+    VertexData v = graph.getData(graph.getTopologyID(id));
+    for (auto val : v.features) {
+      if (val > 0)
+        score += val;
+      else
+        score += -val;
     }
     return score;
   }
 
+  /**
+   * @brief Returns true if `vertex` is on the path that ends at beam node `idx`.
+   */
+  static bool onPath(pando::Vector<BeamNode> beam, std::uint64_t idx, VertexTokenID vertex) {
+    for (std::uint64_t p = idx; p != NO_PARENT;) {
+      BeamNode node = beam[p];
+      if (node.vertex == vertex) {
+        return true;
+      }
+      p = node.parent;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Materializes the path that ends with `node`.
+   */
+  static pando::Vector<std::uint64_t> buildPath(pando::Vector<BeamNode> beam, BeamNode node) {
+    pando::Vector<std::uint64_t> path;
+    PANDO_CHECK(path.initialize(node.length));
+    std::uint64_t pos = node.length - 1;
+    path[pos] = node.vertex;
+    for (std::uint64_t p = node.parent; p != NO_PARENT;) {
+      BeamNode prefix = beam[p];
+      path[--pos] = prefix.vertex;
+      p = prefix.parent;
+    }
+    return path;
+  }
+
 public:
+  /**
+   * @brief Finds the `topK` highest scoring paths from `S` to `T` with at most `Lmax` vertices.
+   *
+   * @details This is a level-synchronous beam search. Every level extends each path of the
+   * frontier by one vertex on the host that owns its last vertex, and then scores the
+   * extensions on the hosts that own the new vertices, so feature fetches are always local.
+   * A path score is the parent score plus the score of the new vertex. The next frontier keeps
+   * the `beamWidth` best extensions of the whole level, with at most `internal_topK` extensions
+   * of the same path, so its size does not grow with the number of levels.
+   */
   pando::Vector<ResultStruct> GreedyReasoning(VertexTokenID S, VertexTopologyID T, Graph graph,
-                                              uint64_t Lmax, uint64_t topK,
-                                              uint64_t internal_topK) {
+                                              uint64_t Lmax, uint64_t topK, uint64_t internal_topK,
+                                              uint64_t beamWidth) {
     VertexTokenID start_id = S;
     VertexTopologyID end_id = T;
 
-    galois::PerThreadVector<ResultStruct> results;
-    galois::PerThreadVector<pando::Vector<std::uint64_t>> new_paths;
-    galois::PerThreadVector<pando::Vector<std::uint64_t>> old_paths;
-    galois::PerThreadVector<ResultStruct> scores;
+    // All the paths that were in a frontier, in level order
+    pando::Vector<BeamNode> beam;
+    // Paths that reached the end vertex
+    pando::Vector<BeamNode> finished;
+    galois::PerThreadVector<BeamNode> candidates;
 
-    PANDO_CHECK(results.initialize());
-    PANDO_CHECK(new_paths.initialize());
-    PANDO_CHECK(old_paths.initialize());
-    PANDO_CHECK(scores.initialize());
+    PANDO_CHECK(beam.initialize(0));
+    PANDO_CHECK(finished.initialize(0));
+    PANDO_CHECK(candidates.initialize());
 
-    pando::Vector<std::uint64_t> vec1;
-    PANDO_CHECK(vec1.initialize(0));
-    PANDO_CHECK(vec1.pushBack(start_id));
-    PANDO_CHECK(fmap(old_paths[0], pushBack, vec1));
+    PANDO_CHECK(
+        beam.pushBack(BeamNode{computeVertexScore(graph, start_id), start_id, NO_PARENT, 1}));
 
     struct State {
-      State() = default;
-      State(galois::WaitGroup::HandleType f,
-            galois::PerThreadVector<pando::Vector<std::uint64_t>> new_paths_, int L_max_,
-            VertexTopologyID end_id_, Graph graph_, galois::PerThreadVector<ResultStruct> results_,
-            galois::PerThreadVector<ResultStruct> scores_, uint64_t internal_topK_)
-          : first(f),
-            new_paths(new_paths_),
-            L_max(L_max_),
-            end_id(end_id_),
-            graph(graph_),
-            results(results_),
-            scores(scores_),
-            internal_topK(internal_topK_) {}
-
-      galois::WaitGroup::HandleType first;
-      galois::PerThreadVector<pando::Vector<std::uint64_t>> new_paths;
-      int L_max;
-      VertexTopologyID end_id;
       Graph graph;
-      galois::PerThreadVector<ResultStruct> results;
-      galois::PerThreadVector<ResultStruct> scores;
-      uint64_t internal_topK;
+      pando::Vector<BeamNode> beam;
+      galois::PerThreadVector<BeamNode> candidates;
+      std::uint64_t L_max;
     };
 
-    while (old_paths.sizeAll() > 0) {
-      scores.clear();
-      galois::WaitGroup wg;
-      State state(wg.getHandle(), new_paths, Lmax, end_id, graph, results, scores, internal_topK);
-      galois::doAll(
-          wg.getHandle(), state, old_paths,
-          +[](State& state, pando::Vector<pando::Vector<std::uint64_t>> vec) {
-            galois::doAll(
-                state.first, state, vec,
-                +[](State& state, pando::Vector<std::uint64_t> vec) {
-                  if (vec.size() == state.L_max) {
-                    return;
-                  }
-                  std::uint64_t last = vec[vec.size() - 1];
-                  pando::Vector<ResultStruct> local_scores;
-                  PANDO_CHECK(local_scores.initialize(0));
-                  for (auto edgeid : state.graph.edges(state.graph.getTopologyID(last))) {
-                    auto next = state.graph.getTokenID(state.graph.getEdgeDst(edgeid));
-                    for (auto x : vec) {
-                      if (x == next)
-                        continue;
-                    }
-                    pando::Vector<std::uint64_t> cand_path;
-                    PANDO_CHECK(cand_path.initialize(vec.size() + 1));
-                    for (std::uint64_t i = 0; i < vec.size(); i++) {
-                      cand_path[i] = vec[i];
-                    }
-                    cand_path[cand_path.size() - 1] = next;
-                    float score = computeScore(cand_path, state.graph);
-                    ResultStruct tmp{score, cand_path};
-                    if (next == state.end_id) {
-                      PANDO_CHECK(state.results.pushBack(tmp));
-                    } else {
-                      PANDO_CHECK(local_scores.pushBack(tmp));
-                    }
-                  }
-                  galois::merge_sort<ResultStruct>(local_scores,
-                                                   [](ResultStruct a, ResultStruct b) {
-                                                     return a.first > b.first;
-                                                   });
-                  int local_scores_size = state.internal_topK;
-                  if (local_scores.size() < state.internal_topK) {
-                    local_scores_size = local_scores.size();
-                  }
-                  pando::Vector<ResultStruct> local_scores_final;
-                  PANDO_CHECK(local_scores_final.initialize(local_scores_size));
-                  for (uint64_t i = 0; i < local_scores_size; i++) {
-                    local_scores_final[i] = local_scores[i];
-                  }
-                  for (ResultStruct score : local_scores_final) {
-                    PANDO_CHECK(state.scores.pushBack(score));
-                  }
-                  local_scores.deinitialize();
-                  local_scores_final.deinitialize();
-                },
-                +[](State state, pando::Vector<std::uint64_t> vec) {
-                  std::uint64_t last = vec[vec.size() - 1];
-                  return state.graph.getLocalityVertex(state.graph.getTopologyID(last));
-                });
-          });
-
-      PANDO_CHECK(wg.wait());
-      new_paths = state.new_paths;
-
-      galois::DistArray<ResultStruct> scores_array;
-      pando::Vector<ResultStruct> scores_vector;
-      PANDO_CHECK(state.scores.assign(scores_array));
-      PANDO_CHECK(scores_vector.initialize(scores_array.size()));
-      for (uint64_t i = 0; i < scores_array.size(); i++) {
-        scores_vector[i] = scores_array[i];
+    std::uint64_t frontierBegin = 0;
+    while (frontierBegin < beam.size()) {
+      candidates.clear();
+
+      // Extend every path of the frontier on the host that owns its last vertex
+      PANDO_CHECK(galois::doAll(
+          State{graph, beam, candidates, Lmax}, galois::IotaRange(frontierBegin, beam.size()),
+          +[](State& state, std::uint64_t idx) {
+            BeamNode node = state.beam[idx];
+            if (node.length >= state.L_max) {
+              return;
+            }
+            for (auto edgeid : state.graph.edges(state.graph.getTopologyID(node.vertex))) {
+              VertexTokenID next = state.graph.getTokenID(state.graph.getEdgeDst(edgeid));
+              if (onPath(state.beam, idx, next)) {
+                continue;
+              }
+              PANDO_CHECK(
+                  state.candidates.pushBack(BeamNode{node.score, next, idx, node.length + 1}));
+            }
+          },
+          +[](State state, std::uint64_t idx) {
+            BeamNode node = state.beam[idx];
+            return state.graph.getLocalityVertex(state.graph.getTopologyID(node.vertex));
+          }));
+
+      // Score the extensions on the host that owns the new vertex
+      galois::DistArray<BeamNode> scored;
+      PANDO_CHECK(candidates.assign(scored));
+      PANDO_CHECK(galois::doAll(
+          graph, scored,
+          +[](Graph graph, pando::GlobalRef<BeamNode> candRef) {
+            BeamNode cand = candRef;
+            cand.score += computeVertexScore(graph, cand.vertex);
+            candRef = cand;
+          },
+          +[](Graph graph, pando::GlobalRef<BeamNode> candRef) {
+            BeamNode cand = candRef;
+            return graph.getLocalityVertex(graph.getTopologyID(cand.vertex));
+          }));
+
+      // Keep the beamWidth best extensions of the level and the internal_topK best of every path
+      pando::Vector<BeamNode> sorted;
+      PANDO_CHECK(sorted.initialize(scored.size()));
+      for (std::uint64_t i = 0; i < scored.size(); i++) {
+        sorted[i] = scored[i];
+      }
+      scored.deinitialize();
+      // ties are broken by parent and vertex, so the beam does not depend on the scoring order
+      galois::merge_sort<BeamNode>(sorted, [](BeamNode a, BeamNode b) {
+        return a.score > b.score ||
+               (a.score == b.score &&
+                (a.parent < b.parent || (a.parent == b.parent && a.vertex < b.vertex)));
+      });
+
+      const std::uint64_t levelBegin = frontierBegin;
+      pando::Vector<std::uint64_t> keptPerParent;
+      PANDO_CHECK(keptPerParent.initialize(beam.size() - levelBegin));
+      for (auto kept : keptPerParent) {
+        kept = 0;
       }
 
-      std::swap(new_paths, old_paths);
-      new_paths.clear();
+      frontierBegin = beam.size();
+      for (BeamNode cand : sorted) {
+        if (cand.vertex == end_id) {
+          PANDO_CHECK(finished.pushBack(cand));
+          continue;
+        }
+        if (beam.size() - frontierBegin == beamWidth) {
+          continue;
+        }
+        std::uint64_t kept = keptPerParent[cand.parent - levelBegin];
+        if (kept < internal_topK) {
+          PANDO_CHECK(beam.pushBack(cand));
+          keptPerParent[cand.parent - levelBegin] = kept + 1;
+        }
+      }
+      keptPerParent.deinitialize();
+      sorted.deinitialize();
     }
 
-    galois::DistArray<ResultStruct> results_array;
-    PANDO_CHECK(results.assign(results_array));
-
-    pando::Vector<ResultStruct> results_vector;
-    PANDO_CHECK(results_vector.initialize(results_array.size()));
-
-    for (uint64_t i = 0; i < results_array.size(); i++) {
-      results_vector[i] = results_array[i];
-    }
-    galois::merge_sort<ResultStruct>(results_vector, [](ResultStruct a, ResultStruct b) {
-      return a.first > b.first;
+    galois::merge_sort<BeamNode>(finished, [](BeamNode a, BeamNode b) {
+      return a.score > b.score;
     });
 
-    int vector_size = topK;
-    if (results_vector.size() < topK) {
-      vector_size = results_vector.size();
+    std::uint64_t vector_size = topK;
+    if (finished.size() < topK) {
+      vector_size = finished.size();
     }
 
     pando::Vector<ResultStruct> results_vector_final;
     PANDO_CHECK(results_vector_final.initialize(vector_size));
 
     for (std::uint64_t i = 0; i < vector_size; i++) {
-      results_vector_final[i] = results_vector[i];
+      BeamNode node = finished[i];
+      results_vector_final[i] = ResultStruct{node.score, buildPath(beam, node)};
     }
 
+    candidates.deinitialize();
+    finished.deinitialize();
+    beam.deinitialize();
     return results_vector_final;
   }
 };
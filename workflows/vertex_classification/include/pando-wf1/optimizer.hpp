@@ -8,6 +8,7 @@
 
 #include <pando-wf1/gnntypes.hpp>
 #include <pando-wf1/layers/layer.hpp>
+#include <pando-wf1/math/elementwise.hpp>
 
 #include <pando-lib-galois/containers/host_indexed_map.hpp>
 
@@ -92,14 +93,8 @@ public:
             pando::Array<GNNFloat> ifm = ifmRef;
             pando::Array<GNNFloat> ism = ismRef;
 
-            galois::doAll(
-                ifm, +[](pando::GlobalRef<GNNFloat> v) {
-                  v = 0;
-                });
-            galois::doAll(
-                ism, +[](pando::GlobalRef<GNNFloat> v) {
-                  v = 0;
-                });
+            PANDO_CHECK(fillBlocks(ifm, GNNFloat{0}));
+            PANDO_CHECK(fillBlocks(ism, GNNFloat{0}));
           }
 
           fmRef = fm;
@@ -142,8 +137,8 @@ public:
       pando::Array<GNNFloat> inGradMat;
       pando::Array<GNNFloat> ifm;
       pando::Array<GNNFloat> ism;
-      GNNFloat b1p;
-      GNNFloat b2p;
+      GNNFloat b1Correction;
+      GNNFloat b2Correction;
     };
 
     galois::doAll(
@@ -158,31 +153,50 @@ public:
           pando::Array<GNNFloat> ifm = fm[l];
           pando::Array<GNNFloat> ism = sm[l];
           pando::Array<GNNFloat> b1pArr = *fmap(tpl.b1p, get, host);
-          pando::Array<GNNFloat> b2pArr = *fmap(tpl.b1p, get, host);
+          pando::Array<GNNFloat> b2pArr = *fmap(tpl.b2p, get, host);
           GNNFloat b1p = b1pArr[l];
           GNNFloat b2p = b2pArr[l];
           pando::Array<GNNFloat> inGradMat = *fmap(tpl.inGradMat, get, host);
           GNNLayerDimensions dim = *fmap(tpl.dim, get, host);
           LayerDimension inGradMatDim = dim.inputColumns * dim.outputColumns;
 
-          galois::doAll(
-              InnerTpl{tpl.config, inMatRef, inGradMat, ifm, ism, b1p, b2p},
-              galois::IotaRange(0, inGradMatDim), +[](InnerTpl tpl, LayerDimension i) {
+          // Weight decay, moment updates, bias correction and the weight update are fused
+          // into a single pass over the weights, gradients and moments.
+          PANDO_CHECK(doAllBlocks(
+              InnerTpl{tpl.config, inMatRef, inGradMat, ifm, ism, GNNFloat(1.0 / (1.0 - b1p)),
+                       GNNFloat(1.0 / (1.0 - b2p))},
+              inGradMatDim, +[](InnerTpl& tpl, LayerDimension offset, LayerDimension n) {
                 AdamConfiguration config = tpl.config;
-                // weight decay:
-                tpl.inGradMat[i] += (5e-4) * tpl.inMat[i];
-
-                tpl.ifm[i] = config.beta1 * tpl.ifm[i] + (1.0 - config.beta1) * tpl.inGradMat[i];
-                tpl.ism[i] = config.beta2 * tpl.ism[i] +
-                             (1.0 - config.beta2) * (tpl.inGradMat[i] * tpl.inGradMat[i]);
-                GNNFloat fbiasCorrect = tpl.ifm[i] / (1.0 - tpl.b1p);
-                GNNFloat sbiasCorrect = tpl.ism[i] / (1.0 - tpl.b2p);
-
-                if (std::sqrt(sbiasCorrect) + config.epsilon != 0) {
-                  tpl.inMat[i] -=
-                      config.alpha * fbiasCorrect / (std::sqrt(sbiasCorrect) + config.epsilon);
+                ElementBlock<GNNFloat> weight;
+                ElementBlock<GNNFloat> grad;
+                ElementBlock<GNNFloat> fmoment;
+                ElementBlock<GNNFloat> smoment;
+                loadBlock(tpl.inMat.data() + offset, weight, n);
+                loadBlock(tpl.inGradMat.data() + offset, grad, n);
+                loadBlock(tpl.ifm.data() + offset, fmoment, n);
+                loadBlock(tpl.ism.data() + offset, smoment, n);
+
+                for (LayerDimension i = 0; i < n; ++i) {
+                  // weight decay:
+                  grad[i] += (5e-4) * weight[i];
+
+                  fmoment[i] = config.beta1 * fmoment[i] + (1.0 - config.beta1) * grad[i];
+                  smoment[i] =
+                      config.beta2 * smoment[i] + (1.0 - config.beta2) * (grad[i] * grad[i]);
+                  GNNFloat fbiasCorrect = fmoment[i] * tpl.b1Correction;
+                  GNNFloat sbiasCorrect = smoment[i] * tpl.b2Correction;
+
+                  GNNFloat denominator = std::sqrt(sbiasCorrect) + config.epsilon;
+                  if (denominator != 0) {
+                    weight[i] -= config.alpha * fbiasCorrect / denominator;
+                  }
                 }
-              });
+
+                storeBlock(tpl.inMat.data() + offset, weight, n);
+                storeBlock(tpl.inGradMat.data() + offset, grad, n);
+                storeBlock(tpl.ifm.data() + offset, fmoment, n);
+                storeBlock(tpl.ism.data() + offset, smoment, n);
+              }));
 
           b1pArr[l] *= tpl.config.beta1;
           b2pArr[l] *= tpl.config.beta2;
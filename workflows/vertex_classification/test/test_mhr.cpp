@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023. University of Texas at Austin. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "pando-rt/export.h"
+
+#include <pando-lib-galois/graphs/graph_traits.hpp>
+#include <pando-rt/containers/vector.hpp>
+#include <pando-rt/pando-rt.hpp>
+#include <pando-wf1/graphs/mhr_graph.hpp>
+#include <pando-wf1/mhr.hpp>
+
+namespace {
+
+constexpr std::uint64_t numNodes = 7;
+constexpr std::uint64_t startNode = 0;
+constexpr std::uint64_t endNode = 6;
+
+// Layered graph 0 -> {1, 2, 3} -> {4, 5} -> 6, where the score of every vertex is its only
+// feature. The 6 paths from 0 to 6 score {1, 2, 3} + {10, 20}.
+wf1::MHRGraph generateLayeredGraph() {
+  const double scores[numNodes] = {0, 1, 2, 3, 10, 20, 0};
+
+  pando::Vector<wf1::MHRNode> vertices;
+  pando::Vector<galois::GenericEdge<wf1::MHREdge>> edges;
+  EXPECT_EQ(vertices.initialize(numNodes), pando::Status::Success);
+  EXPECT_EQ(edges.initialize(0), pando::Status::Success);
+
+  for (std::uint64_t i = 0; i < numNodes; i++) {
+    wf1::MHRNode node;
+    node.id = i;
+    EXPECT_EQ(node.features.initialize(1), pando::Status::Success);
+    node.features[0] = scores[i];
+    vertices[i] = node;
+  }
+
+  auto addEdge = [&edges](std::uint64_t src, std::uint64_t dst) {
+    wf1::MHREdge edge;
+    edge.src = src;
+    edge.dst = dst;
+    EXPECT_EQ(edges.pushBack(galois::GenericEdge<wf1::MHREdge>(src, dst, edge)),
+              pando::Status::Success);
+  };
+  for (std::uint64_t mid = 1; mid <= 3; mid++) {
+    addEdge(0, mid);
+  }
+  for (std::uint64_t mid = 1; mid <= 3; mid++) {
+    addEdge(mid, 4);
+    addEdge(mid, 5);
+  }
+  addEdge(4, endNode);
+  addEdge(5, endNode);
+  // the end vertex is never extended, so this edge only keeps every host non-empty
+  addEdge(endNode, startNode);
+
+  wf1::MHRGraph graph{};
+  EXPECT_EQ(graph.initialize(vertices, edges), pando::Status::Success);
+  vertices.deinitialize();
+  edges.deinitialize();
+  return graph;
+}
+
+void deinitializeGraph(wf1::MHRGraph& graph) {
+  for (wf1::MHRGraph::VertexTopologyID vertex : graph.vertices()) {
+    wf1::MHRNode node = graph.getData(vertex);
+    node.deinitialize();
+  }
+  graph.deinitialize();
+}
+
+void expectPath(pando::Vector<std::uint64_t> path, std::initializer_list<std::uint64_t> expected) {
+  ASSERT_EQ(path.size(), expected.size());
+  std::uint64_t i = 0;
+  for (std::uint64_t vertex : expected) {
+    EXPECT_EQ(path[i++], vertex);
+  }
+}
+
+void deinitializeResults(pando::Vector<galois::Pair<float, pando::Vector<std::uint64_t>>> results) {
+  for (galois::Pair<float, pando::Vector<std::uint64_t>> result : results) {
+    result.second.deinitialize();
+  }
+  results.deinitialize();
+}
+
+} // namespace
+
+TEST(MHR, GreedyReasoningTopK) {
+  wf1::MHRGraph graph = generateLayeredGraph();
+  mhr::MHR<wf1::MHRGraph> mhr;
+
+  auto results = mhr.GreedyReasoning(startNode, endNode, graph, 4, 2, 3, 100);
+  ASSERT_EQ(results.size(), 2);
+  galois::Pair<float, pando::Vector<std::uint64_t>> best = results[0];
+  galois::Pair<float, pando::Vector<std::uint64_t>> second = results[1];
+  EXPECT_EQ(best.first, 23);
+  expectPath(best.second, {0, 3, 5, 6});
+  EXPECT_EQ(second.first, 22);
+  expectPath(second.second, {0, 2, 5, 6});
+  deinitializeResults(results);
+
+  // paths may not have more than Lmax vertices
+  results = mhr.GreedyReasoning(startNode, endNode, graph, 3, 2, 3, 100);
+  EXPECT_EQ(results.size(), 0);
+  deinitializeResults(results);
+
+  deinitializeGraph(graph);
+}
+
+TEST(MHR, GreedyReasoningBeamWidth) {
+  wf1::MHRGraph graph = generateLayeredGraph();
+  mhr::MHR<wf1::MHRGraph> mhr;
+
+  // Only the best path of every level is kept, so a single path reaches the end vertex even
+  // though every path keeps two extensions
+  auto results = mhr.GreedyReasoning(startNode, endNode, graph, 4, 6, 2, 1);
+  ASSERT_EQ(results.size(), 1);
+  galois::Pair<float, pando::Vector<std::uint64_t>> best = results[0];
+  EXPECT_EQ(best.first, 23);
+  expectPath(best.second, {0, 3, 5, 6});
+  deinitializeResults(results);
+
+  // With two paths per level, the frontiers are {3, 2} and {3 -> 5, 2 -> 5}
+  results = mhr.GreedyReasoning(startNode, endNode, graph, 4, 6, 2, 2);
+  ASSERT_EQ(results.size(), 2);
+  galois::Pair<float, pando::Vector<std::uint64_t>> first = results[0];
+  galois::Pair<float, pando::Vector<std::uint64_t>> second = results[1];
+  EXPECT_EQ(first.first, 23);
+  expectPath(first.second, {0, 3, 5, 6});
+  EXPECT_EQ(second.first, 22);
+  expectPath(second.second, {0, 2, 5, 6});
+  deinitializeResults(results);
+
+  deinitializeGraph(graph);
+}